@@ -0,0 +1,70 @@
+#include "Bench.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Global operator new replacement that counts heap allocations.
+// Only active in HYPRZONES_BENCH_COUNT_ALLOCS builds so regular benchmark
+// numbers are not skewed by the counter.
+
+namespace HyprZones::Bench {
+
+#ifdef HYPRZONES_BENCH_COUNT_ALLOCS
+
+static std::atomic<size_t> g_allocations{0};
+
+bool allocationCountingEnabled() {
+    return true;
+}
+
+size_t allocationCount() {
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+}  // namespace HyprZones::Bench
+
+static void* countedAlloc(std::size_t size) {
+    HyprZones::Bench::g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size) {
+    return countedAlloc(size);
+}
+
+void* operator new[](std::size_t size) {
+    return countedAlloc(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+#else
+
+bool allocationCountingEnabled() {
+    return false;
+}
+
+size_t allocationCount() {
+    return 0;
+}
+
+}  // namespace HyprZones::Bench
+
+#endif
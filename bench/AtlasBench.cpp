@@ -0,0 +1,92 @@
+#include "Bench.hpp"
+
+#include "hyprzones/DigitAtlas.hpp"
+
+#include <cmath>
+#include <string>
+#include <unordered_map>
+
+using namespace HyprZones;
+
+namespace {
+
+DigitAtlasMetrics makeMetrics(float scale) {
+    DigitAtlasMetrics metrics = DigitAtlasMetrics::forScale(scale);
+    metrics.digitWidth        = static_cast<int>(15 * scale);
+    return metrics;
+}
+
+void checkCompose() {
+    DigitAtlasMetrics metrics = makeMetrics(1.0f);
+    BadgeQuads        quads;
+
+    size_t count = composeBadge(metrics, 123, 500, 300, quads);
+    if (count != 4 || quads[1].src.x != metrics.digit(1).x || quads[3].src.x != metrics.digit(3).x) {
+        Bench::fail("atlas", "composeBadge(123) picked the wrong cells");
+        return;
+    }
+    double left  = quads[1].dst.x;
+    double right = quads[3].dst.x + quads[3].dst.w;
+    if (std::abs((left + right) / 2 - 500) > 1e-9 || quads[0].dst.w != metrics.badgeSize) {
+        Bench::fail("atlas", "badge is not centred");
+    }
+
+    // Too wide for the circle: digits narrowed to fit
+    count = composeBadge(metrics, 123456, 500, 300, quads);
+    if (count != 7 || quads[6].dst.x + quads[6].dst.w - quads[1].dst.x > metrics.badgeSize - metrics.padding + 1e-9) {
+        Bench::fail("atlas", "long numbers overflow the badge");
+    }
+}
+
+void checkLru() {
+    DigitAtlasCache<int> cache(2);
+    cache.insert(100, 1);
+    cache.insert(150, 2);
+    cache.find(100);       // 150 is now least recently used
+    cache.insert(200, 3);  // evicts 150
+    if (cache.size() != 2 || !cache.find(100) || cache.find(150) || !cache.find(200)) {
+        Bench::fail("atlas", "LRU evicted the wrong scale");
+    }
+}
+
+void runAtlasBench() {
+    checkCompose();
+    checkLru();
+
+    DigitAtlasCache<DigitAtlasMetrics> cache;
+    for (float scale : {1.0f, 1.25f, 1.5f, 2.0f}) {
+        cache.insert(atlasScaleKey(scale), makeMetrics(scale));
+    }
+
+    // One frame's numbers for zone counts of a real layout
+    for (int zones : {4, 16, 64}) {
+        BadgeQuads quads;
+        double     frame = Bench::measure(
+            [&] {
+                const DigitAtlasMetrics* metrics = cache.find(atlasScaleKey(1.5f));
+                for (int i = 1; i <= zones; ++i) {
+                    Bench::doNotOptimize(composeBadge(*metrics, i, i * 40.0, 300, quads));
+                }
+            },
+            zones);
+        Bench::report("atlas", "badge/atlas", static_cast<size_t>(zones), frame);
+
+        // Previous per-number lookup: string key into a texture map
+        std::unordered_map<std::string, int> textures;
+        for (int i = 1; i <= zones; ++i) {
+            textures[std::to_string(i) + "_" + std::to_string(150)] = i;
+        }
+        double keyed = Bench::measure(
+            [&] {
+                for (int i = 1; i <= zones; ++i) {
+                    Bench::doNotOptimize(textures.find(std::to_string(i) + "_" + std::to_string(150)));
+                }
+            },
+            zones);
+        Bench::report("atlas", "badge/stringKey", static_cast<size_t>(zones), keyed);
+    }
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("atlas", runAtlasBench);
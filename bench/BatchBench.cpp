@@ -0,0 +1,88 @@
+#include "Bench.hpp"
+
+#include "hyprzones/BatchCommand.hpp"
+
+#include <cstdio>
+#include <string>
+
+using namespace HyprZones;
+
+namespace {
+
+void checkParse() {
+    auto ops = parseBatch("moveto 0x55d3c0a1b2c0 2; moveto address:0x1f 1-3 \"Dev Layout\"\n"
+                          "layout DP-1 coding;layout focus ; show;hide;;");
+    if (ops.size() != 6) {
+        Bench::fail("batch", "wrong operation count");
+        return;
+    }
+    if (ops[0].op != BatchOp::MoveTo || ops[0].window != 0x55d3c0a1b2c0 || ops[0].zoneStart != 2 ||
+        ops[0].zoneEnd != 2 || !ops[0].layout.empty() || !ops[0].error.empty()) {
+        Bench::fail("batch", "single-zone moveto misparsed");
+    }
+    if (ops[1].window != 0x1f || ops[1].zoneStart != 1 || ops[1].zoneEnd != 3 || ops[1].layout != "Dev Layout") {
+        Bench::fail("batch", "span moveto with quoted layout misparsed");
+    }
+    if (ops[2].op != BatchOp::Layout || ops[2].monitor != "DP-1" || ops[2].layout != "coding" ||
+        !ops[3].monitor.empty() || ops[3].layout != "focus") {
+        Bench::fail("batch", "layout operations misparsed");
+    }
+    if (ops[4].op != BatchOp::Show || ops[5].op != BatchOp::Hide) {
+        Bench::fail("batch", "show/hide misparsed");
+    }
+
+    // Bad operations are reported in place; the rest still parse
+    auto bad = parseBatch("moveto zz 1; moveto 0x10 x; jump 3; layout; show now; layout \"open");
+    if (bad.size() != 6) {
+        Bench::fail("batch", "bad operations dropped");
+        return;
+    }
+    for (const auto& op : bad) {
+        if (op.error.empty()) {
+            Bench::fail("batch", std::string("accepted bad ") + batchOpName(op.op) + " operation");
+        }
+    }
+}
+
+void checkFormat() {
+    auto ops = parseBatch("show; jump \"a\\\"b\"");
+    ops[1].error = "bad \"name\"\n";
+    std::string json = formatBatchResults(ops);
+    if (json != R"([{"op":"show","ok":true},{"op":"invalid","ok":false,"error":"bad \"name\"\u000a"}])") {
+        Bench::fail("batch", "unexpected result JSON: " + json);
+    }
+}
+
+// The login script case: place N windows, switch two monitors, show
+std::string makeScript(int windows) {
+    std::string out;
+    for (int i = 0; i < windows; ++i) {
+        char line[64];
+        std::snprintf(line, sizeof(line), "moveto 0x%x %d-%d; ", 0x5500 + i * 0x40, i % 4, i % 4 + 1);
+        out += line;
+    }
+    out += "layout DP-1 coding; layout HDMI-A-1 \"wide screen\"; show";
+    return out;
+}
+
+void runBatchBench() {
+    checkParse();
+    checkFormat();
+
+    for (int windows : {1, 20, 200}) {
+        std::string script = makeScript(windows);
+        auto        ops    = parseBatch(script);
+        if (ops.size() != static_cast<size_t>(windows) + 3) {
+            Bench::fail("batch", "generated script misparsed");
+            return;
+        }
+
+        size_t n = ops.size();
+        Bench::report("batch", "parse", n, Bench::measure([&] { Bench::doNotOptimize(parseBatch(script).size()); }));
+        Bench::report("batch", "format", n, Bench::measure([&] { Bench::doNotOptimize(formatBatchResults(ops).size()); }));
+    }
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("batch", runBatchBench);
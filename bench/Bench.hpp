@@ -0,0 +1,63 @@
+#pragma once
+
+// Minimal benchmark harness for the Hyprland-independent core.
+// Suites register themselves with HZ_BENCH_SUITE and are run from main.cpp.
+
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+namespace HyprZones::Bench {
+
+using SuiteFn = void (*)();
+
+struct Registrar {
+    Registrar(const char* name, SuiteFn fn);
+};
+
+// Keep the compiler from discarding a computed value
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Time fn() repeatedly for at least minMillis and return ns per operation.
+// fn() must perform opsPerCall operations per invocation.
+template <typename Fn>
+double measure(Fn&& fn, size_t opsPerCall = 1, int minMillis = 100) {
+    using Clock = std::chrono::steady_clock;
+
+    fn();  // warm-up
+
+    size_t iterations = 0;
+    auto   start      = Clock::now();
+    auto   deadline   = start + std::chrono::milliseconds(minMillis);
+    auto   now        = start;
+    do {
+        for (int i = 0; i < 16; ++i) {
+            fn();
+        }
+        iterations += 16;
+        now = Clock::now();
+    } while (now < deadline);
+
+    double ns = std::chrono::duration<double, std::nano>(now - start).count();
+    return ns / static_cast<double>(iterations * opsPerCall);
+}
+
+// Print one result row: suite, case, scaling parameter, ns/op
+void report(std::string_view suite, std::string_view name, size_t param, double nsPerOp);
+
+// Heap allocations made so far (HYPRZONES_BENCH_COUNT_ALLOCS builds only)
+bool   allocationCountingEnabled();
+size_t allocationCount();
+
+// Record a failed check; main() then exits non-zero
+void fail(std::string_view suite, std::string_view message);
+
+}  // namespace HyprZones::Bench
+
+#define HZ_BENCH_CONCAT_(a, b) a##b
+#define HZ_BENCH_CONCAT(a, b)  HZ_BENCH_CONCAT_(a, b)
+#define HZ_BENCH_SUITE(name, fn) \
+    static ::HyprZones::Bench::Registrar HZ_BENCH_CONCAT(s_benchSuite, __LINE__)(name, fn)
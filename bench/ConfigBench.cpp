@@ -0,0 +1,287 @@
+#include "Bench.hpp"
+
+#include "hyprzones/Config.hpp"
+#include "hyprzones/ConfigCache.hpp"
+#include "hyprzones/ConfigDiff.hpp"
+#include "hyprzones/LayoutManager.hpp"
+#include "hyprzones/Stats.hpp"
+#include "hyprzones/WindowSnapper.hpp"
+#include "hyprzones/ZoneManager.hpp"
+
+#include <filesystem>
+#include <string>
+#include <unistd.h>
+
+using namespace HyprZones;
+
+namespace {
+
+// hyprzones.toml with `layouts` grid layouts of zonesPerLayout zones each
+// and one mapping per layout, plus a [general] section and two monitor overrides
+std::string makeConfig(int layouts, int zonesPerLayout, int mappings) {
+    std::string out;
+    out += "[general]\n";
+    out += "snap_modifier = \"SHIFT\"\n";
+    out += "zone_highlight_color = \"rgba(0, 102, 255, 0.3)\"\n";
+    out += "zone_border_width = 3  # pixels\n";
+    out += "sensitivity_radius = 20\n\n";
+
+    for (int l = 0; l < layouts; ++l) {
+        out += "[[layouts]]\n";
+        out += "name = \"layout-" + std::to_string(l) + "\"\n";
+        out += "spacing_h = 40\nspacing_v = 10\n\n";
+        for (int z = 0; z < zonesPerLayout; ++z) {
+            out += "[[layouts.zones]]\n";
+            out += "name = \"Zone " + std::to_string(z) + "\"\n";
+            out += "x = " + std::to_string(z % 10 * 10) + "\n";
+            out += "y = " + std::to_string(z / 10 % 10 * 10) + ".5\n";
+            out += "width = 10\nheight = 9.5\n\n";
+        }
+    }
+
+    for (int m = 0; m < mappings; ++m) {
+        out += "[[mappings]]\n";
+        out += "monitor = \"DP-" + std::to_string(m % 4) + "\"\n";
+        out += "workspaces = \"" + std::to_string(m % 10 + 1) + "-" + std::to_string(m % 10 + 5) + "\"\n";
+        out += "layout = \"layout-" + std::to_string(m % layouts) + "\"\n\n";
+    }
+
+    out += "[[monitors]]\nmonitor = \"*\"\nreserved_top = 40\n\n";
+    out += "[[monitors]]\nmonitor = \"DP-1\"\nreserved_left = 0\nreserved_right = 12\n";
+    return out;
+}
+
+Config loadCompiled(const std::string& text) {
+    auto result = parseConfig(text);
+    LayoutManager::compileMappings(result.config);
+    return std::move(result.config);
+}
+
+// A drag pinned to snapshot A refills the lookup memo after B changed the
+// mappings; C (same mappings as B) must not resolve through A's entries
+void checkSnapshotMemo() {
+    std::string textA = makeConfig(10, 2, 10);
+    std::string textB = textA;
+    textB.replace(textB.find("layout = \"layout-1\"\n"), 20, "layout = \"layout-7\"\n");
+
+    Config a = loadCompiled(textA);
+    Config b = loadCompiled(textB);
+    Config c = loadCompiled(textB);
+    Config d = loadCompiled(textB);
+    if (!diffConfig(a, b).mappingsChanged || diffConfig(b, c).mappingsChanged || diffConfig(c, d).mappingsChanged ||
+        c.mappingsGeneration != b.mappingsGeneration) {
+        Bench::fail("config", "mapping generation not carried over exactly for unchanged mappings");
+        return;
+    }
+
+    // DP-1, workspace 2: layout-1 in A, layout-7 from B on
+    LayoutManager manager;
+    const Layout* pinned = manager.getLayoutForMonitor(a, "DP-1", 2);
+    const Layout* now    = manager.getLayoutForMonitor(c, "DP-1", 2);
+    if (!pinned || pinned->name != "layout-1" || !now || now->name != "layout-7") {
+        Bench::fail("config", "snapshot resolved through another snapshot's lookup memo");
+    }
+
+    // Same mappings: D keeps C's memo
+    uint64_t hits = g_stats.counter(Counter::MappingCacheHits);
+    const Layout* kept = manager.getLayoutForMonitor(d, "DP-1", 2);
+    if (!kept || kept->name != "layout-7" || g_stats.counter(Counter::MappingCacheHits) != hits + 1) {
+        Bench::fail("config", "unchanged mappings lost their memoized lookups");
+    }
+}
+
+// A reload that drops and reorders zones moves remembered windows by zone name
+void checkZoneRemap() {
+    const std::string before = "[[layouts]]\nname = \"main\"\n"
+                               "[[layouts.zones]]\nname = \"A\"\nx = 0\ny = 0\nwidth = 33\nheight = 100\n"
+                               "[[layouts.zones]]\nname = \"B\"\nx = 33\ny = 0\nwidth = 33\nheight = 100\n"
+                               "[[layouts.zones]]\nname = \"C\"\nx = 66\ny = 0\nwidth = 34\nheight = 100\n";
+    const std::string after  = "[[layouts]]\nname = \"main\"\n"
+                               "[[layouts.zones]]\nname = \"C\"\nx = 0\ny = 0\nwidth = 50\nheight = 100\n"
+                               "[[layouts.zones]]\nname = \"A\"\nx = 50\ny = 0\nwidth = 50\nheight = 100\n";
+    Config oldConfig = loadCompiled(before);
+    Config newConfig = loadCompiled(after);
+
+    ZoneManager   zm;
+    WindowSnapper snapper(zm);
+    int           spanning = 0, dropped = 0;
+    ZoneSelection ac, b;
+    ac.add(0);
+    ac.add(2);
+    b.add(1);
+    snapper.rememberWindow(&spanning, "DP-1", "main", ac, 0, 0, 100, 100);
+    snapper.rememberWindow(&dropped, "DP-1", "main", b, 0, 0, 100, 100);
+
+    ConfigDiff diff = diffConfig(oldConfig, newConfig);
+    if (diff.changed != 1 || diff.remaps.size() != 1 || diff.remaps[0].layout != "main") {
+        Bench::fail("config", "reordered zones produced no remap");
+        return;
+    }
+    snapper.remapZones(diff.remaps[0].layout, diff.remaps[0].oldToNew);
+
+    // A (0) -> 1, C (2) -> 0, B is gone
+    if (snapper.getMemory(&spanning)->zones.toVector() != std::vector<int>{0, 1} ||
+        !snapper.getMemory(&dropped)->zones.empty()) {
+        Bench::fail("config", "remap did not move window memory by zone name");
+    }
+}
+
+// Zones past ZoneSelection::CAPACITY are dropped with an error, not kept
+// as zones no selection can address
+void checkZoneLimit() {
+    auto result = parseConfig(makeConfig(1, ZoneSelection::CAPACITY + 6, 0));
+    if (result.config.layouts.size() != 1 ||
+        result.config.layouts[0].zones.size() != static_cast<size_t>(ZoneSelection::CAPACITY) ||
+        result.errors.size() != 1 || result.errors[0].message.find("6 zones") == std::string::npos) {
+        Bench::fail("config", "oversized layout not capped with one error");
+    }
+}
+
+// Colors are written as the shortest text that reads back to the same
+// float, so a hand-written rgba() survives a save unchanged
+void checkColorRoundTrip() {
+    auto result = parseConfig(makeConfig(1, 1, 0));
+    result.config.borderColor = {1.0f / 3.0f, 0.1f, 0.7f, 0.123456789f};
+
+    std::string saved    = serializeConfig(result.config);
+    auto        reparsed = parseConfig(saved);
+    auto        same     = [](const Color& a, const Color& b) {
+        return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+    };
+    if (saved.find("zone_highlight_color = \"rgba(0, 102, 255, 0.3)\"") == std::string::npos) {
+        Bench::fail("config", "rgba(0, 102, 255, 0.3) not saved unchanged");
+    }
+    if (!reparsed.errors.empty() || !same(reparsed.config.highlightColor, result.config.highlightColor) ||
+        !same(reparsed.config.borderColor, result.config.borderColor)) {
+        Bench::fail("config", "saved colors did not read back bit-identical");
+    }
+}
+
+// A mapping without a monitor key is an error, not a catch-all that beats
+// the active-layout fallback; "*" still matches every monitor
+void checkMappingMonitor() {
+    std::string text = makeConfig(3, 1, 0);
+    text += "\n[[mappings]]\nworkspaces = \"*\"\nlayout = \"layout-1\"\n";
+    text += "\n[[mappings]]\nmonitor = \"*\"\nworkspaces = \"9\"\nlayout = \"layout-2\"\n";
+    auto result = parseConfig(text);
+    if (result.errors.size() != 1 || result.errors[0].message.find("without monitor") == std::string::npos ||
+        result.config.mappings.size() != 1) {
+        Bench::fail("config", "mapping without monitor not reported and skipped");
+        return;
+    }
+
+    // Built in code: skipped when compiling
+    result.config.mappings.push_back({"", "*", "layout-1"});
+    result.config.activeLayout = "layout-0";
+    LayoutManager::compileMappings(result.config);
+    LayoutManager manager;
+    const Layout* fallback = manager.getLayoutForMonitor(result.config, "DP-3", 1);
+    const Layout* any      = manager.getLayoutForMonitor(result.config, "DP-3", 9);
+    if (result.config.compiledMappings.size() != 1 || !fallback || fallback->name != "layout-0" || !any ||
+        any->name != "layout-2") {
+        Bench::fail("config", "mapping without monitor matched every monitor");
+    }
+}
+
+void runConfigBench() {
+    checkColorRoundTrip();
+    checkMappingMonitor();
+    checkSnapshotMemo();
+    checkZoneLimit();
+    checkZoneRemap();
+
+    std::string cachePath =
+        (std::filesystem::temp_directory_path() / ("hyprzones-bench-" + std::to_string(getpid()) + ".bin")).string();
+
+    for (int layouts : {10, 100, 1000}) {
+        int         zonesPerLayout = 10;
+        int         mappings       = layouts;
+        std::string text           = makeConfig(layouts, zonesPerLayout, mappings);
+
+        auto check = parseConfig(text);
+        if (!check.errors.empty() || check.config.layouts.size() != static_cast<size_t>(layouts) ||
+            check.config.mappings.size() != static_cast<size_t>(mappings) || check.config.borderWidth != 3 ||
+            check.config.monitorOverrides.size() != 2 || check.config.monitorOverrides[1].reservedRight != 12 ||
+            check.config.monitorOverrides[1].reservedTop != -1) {
+            Bench::fail("config", "generated config did not round-trip");
+            return;
+        }
+
+        double ns = Bench::measure([&] {
+            auto result = parseConfig(text);
+            Bench::doNotOptimize(result.config.layouts.size());
+        });
+        Bench::report("config", "parse/zones", static_cast<size_t>(layouts * zonesPerLayout), ns);
+        Bench::report("config", "parse/per-KiB", text.size() / 1024, ns / (static_cast<double>(text.size()) / 1024));
+
+        // Startup path with a valid snapshot: mmap, validate, copy records out
+        LayoutManager::compileMappings(check.config);
+        check.config.sourceHash = hashConfigText(text);
+        ConfigSource source{"bench.toml", text.size(), {1, 0}};
+        if (!saveConfigCache(cachePath, source, check.config)) {
+            Bench::fail("config", "cannot write " + cachePath);
+            return;
+        }
+
+        Config loaded;
+        if (!loadConfigCache(cachePath, source, text, loaded) ||
+            loaded.layouts.size() != check.config.layouts.size() ||
+            loaded.compiledMappings.size() != check.config.compiledMappings.size() ||
+            loaded.monitorOverrides != check.config.monitorOverrides || loaded.sourceHash != check.config.sourceHash) {
+            Bench::fail("config", "cache did not round-trip");
+            return;
+        }
+
+        double cached = Bench::measure([&] {
+            Config config;
+            loadConfigCache(cachePath, source, text, config);
+            Bench::doNotOptimize(config.layouts.size());
+        });
+        Bench::report("config", "cache-load/zones", static_cast<size_t>(layouts * zonesPerLayout), cached);
+
+        double hashed = Bench::measure([&] { Bench::doNotOptimize(hashConfigText(text)); });
+        Bench::report("config", "hash/zones", static_cast<size_t>(layouts * zonesPerLayout), hashed);
+
+        // Save path (ConfigSaver's worker): the text must parse back to the
+        // exact same layouts, including values with no short decimal form
+        check.config.layouts[0].zones[0].x = 1.0 / 3.0;
+        std::string saved    = serializeConfig(check.config);
+        auto        reparsed = parseConfig(saved);
+        LayoutManager::compileMappings(reparsed.config);
+        ConfigDiff same = diffConfig(check.config, reparsed.config);
+        if (!reparsed.errors.empty() || same.unchanged != static_cast<size_t>(layouts) || same.mappingsChanged ||
+            same.monitorsChanged) {
+            Bench::fail("config", "serialized config did not round-trip");
+            return;
+        }
+
+        double serialized = Bench::measure([&] { Bench::doNotOptimize(serializeConfig(check.config).size()); });
+        Bench::report("config", "serialize/zones", static_cast<size_t>(layouts * zonesPerLayout), serialized);
+    }
+
+    std::filesystem::remove(cachePath);
+
+    // Reload after editing one zone of a 40-layout config: only that layout
+    // may get a new generation
+    std::string before = makeConfig(40, 10, 40);
+    std::string after  = before;
+    after.replace(after.find("width = 10"), 10, "width = 12");
+
+    auto oldResult = parseConfig(before);
+    LayoutManager::compileMappings(oldResult.config);
+
+    ConfigDiff diff;
+    double     ns = Bench::measure([&] {
+        auto newResult = parseConfig(after);
+        LayoutManager::compileMappings(newResult.config);
+        diff = diffConfig(oldResult.config, newResult.config);
+    });
+    if (diff.unchanged != 39 || diff.changed != 1 || diff.mappingsChanged) {
+        Bench::fail("config", "one-zone edit invalidated more than its layout");
+    }
+    Bench::report("config", "reload+diff/one-zone-edit", 40, ns);
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("config", runConfigBench);
@@ -0,0 +1,117 @@
+#include "Bench.hpp"
+#include "Fixtures.hpp"
+
+#include "hyprzones/DamageRegion.hpp"
+#include "hyprzones/ZoneManager.hpp"
+
+using namespace HyprZones;
+
+namespace {
+
+bool sameBox(const GeometryBox& a, const GeometryBox& b) {
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+void checkRegion() {
+    DamageRegion region;
+    region.add({0, 0, 0, 10});
+    region.add({0, 0, 10, -1});
+    if (!region.empty()) {
+        Bench::fail("damage", "empty boxes were added");
+    }
+
+    // Covered boxes are dropped either way round
+    region.add({10, 10, 20, 20});
+    region.add({15, 15, 5, 5});
+    region.add({100, 0, 10, 10});
+    region.add({0, 0, 50, 50});
+    if (region.boxes().size() != 2 || !sameBox(region.boxes()[1], {0, 0, 50, 50})) {
+        Bench::fail("damage", "covered boxes were kept");
+    }
+    if (region.area() != 2600 || !sameBox(region.bounds(), {0, 0, 110, 50})) {
+        Bench::fail("damage", "wrong area or bounds");
+    }
+
+    // Past MAX_BOXES everything collapses into the bounding box
+    region.clear();
+    for (size_t i = 0; i <= DamageRegion::MAX_BOXES; ++i) {
+        region.add({i * 100.0, 0, 10, 10});
+    }
+    if (region.boxes().size() != 1 || !sameBox(region.boxes()[0], {0, 0, DamageRegion::MAX_BOXES * 100.0 + 10, 10})) {
+        Bench::fail("damage", "overflow did not collapse to the bounding box");
+    }
+}
+
+void checkHighlight(const ResolvedLayout& resolved) {
+    const auto& zones   = resolved.layout.zones;
+    const auto& monitor = resolved.key.monitor;
+    const int   border  = 3;
+
+    ZoneSelection before, after;
+    before.add(0);  // top-left corner: growth is clipped to the monitor
+    after.add(5);
+
+    DamageRegion region;
+    addHighlightDamage(region, resolved, before, after, border);
+    if (region.boxes().size() != 2) {
+        Bench::fail("damage", "expected one box per changed zone");
+        return;
+    }
+
+    const Zone& z0 = zones[0];
+    const Zone& z5 = zones[5];
+    double      g  = border + 1;
+    if (!sameBox(region.boxes()[0], {monitor.x, monitor.y, z0.pixelX + z0.pixelW + g - monitor.x,
+                                     z0.pixelY + z0.pixelH + g - monitor.y}) ||
+        !sameBox(region.boxes()[1], {z5.pixelX - g, z5.pixelY - g, z5.pixelW + 2 * g, z5.pixelH + 2 * g})) {
+        Bench::fail("damage", "zone boxes not grown by the border or not clipped");
+    }
+    if (!region.contains(z5.pixelX - border, z5.pixelY + 1) || region.contains(zones[10].pixelX + zones[10].pixelW / 2,
+                                                                               zones[10].pixelY + zones[10].pixelH / 2)) {
+        Bench::fail("damage", "region misses the border or covers an untouched zone");
+    }
+    if (region.area() > monitor.width * monitor.height / 8) {
+        Bench::fail("damage", "highlight damage is not much smaller than the monitor");
+    }
+
+    // A zone in both selections is damaged once
+    after.add(0);
+    region.clear();
+    addHighlightDamage(region, resolved, before, after, border);
+    if (region.boxes().size() != 2) {
+        Bench::fail("damage", "zone selected before and after was added twice");
+    }
+}
+
+void runDamageBench() {
+    MonitorGeometry monitor;
+    monitor.x      = 1920;
+    monitor.width  = 7680;
+    monitor.height = 4320;
+    monitor.scale  = 2.0;
+
+    ZoneManager zm;
+    for (int dim : {4, 16}) {
+        auto resolved = zm.buildResolvedLayout(Bench::makeGrid("damage", dim), monitor);
+        if (dim == 4) {
+            checkRegion();
+            checkHighlight(*resolved);
+        }
+
+        // Typical move: one zone unhighlighted, the neighbour highlighted
+        ZoneSelection before, after;
+        before.add(1);
+        after.add(2);
+        DamageRegion region;
+        double       ns = Bench::measure([&] {
+            region.clear();
+            addHighlightDamage(region, *resolved, before, after, 3);
+            Bench::doNotOptimize(region.area());
+        });
+        Bench::report("damage", "highlight/region", resolved->layout.zones.size(), ns);
+    }
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("damage", runDamageBench);
@@ -0,0 +1,147 @@
+#include "Bench.hpp"
+#include "Fixtures.hpp"
+
+#include "hyprzones/Config.hpp"
+#include "hyprzones/DragSession.hpp"
+#include "hyprzones/ZoneManager.hpp"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace HyprZones;
+
+namespace {
+
+// One steady-state drag step: cursor update, plus the per-frame work the
+// renderer and drop path do with the selection
+int dragStep(ZoneManager& zm, DragSession& session, double x, double y) {
+    int touched = session.updateCursor(zm, x, y) ? 1 : 0;
+
+    const auto& zones = session.layout->layout.zones;
+    for (size_t i = 0; i < zones.size(); ++i) {
+        touched += session.selectedZones.contains(static_cast<int>(i));
+    }
+
+    double bx, by, bw, bh;
+    zm.getCombinedZoneBox(session.layout->layout, session.selectedZones, bx, by, bw, bh);
+    return touched + static_cast<int>(bw);
+}
+
+// Cursor resting on the gap between two zones, jittering a few pixels:
+// highlight changes without and with a sensitivity radius
+void checkHysteresis(ZoneManager& zm, const MonitorGeometry& monitor) {
+    auto resolved = zm.resolveLayout("hysteresis", Bench::makeGrid("drag", 3), monitor);
+    const auto& zones = resolved->layout.zones;
+    double      edge  = (zones[0].pixelX + zones[0].pixelW + zones[1].pixelX) / 2;  // middle of the gap
+    double      y     = zones[0].centerY();
+
+    auto run = [&](int radius, int& changes) {
+        auto config               = std::make_shared<Config>();
+        config->sensitivityRadius = radius;
+
+        DragSession session;
+        session.isDragging     = true;
+        session.isZoneSnapping = true;
+        session.config         = config;
+        session.setMonitor(nullptr, resolved);
+
+        session.updateCursor(zm, zones[0].centerX(), y);  // start well inside zone 0
+        changes = 0;
+        for (int i = 0; i < 256; ++i) {
+            double jitter = (i * 7 % 25) - 12;  // -12 .. 12 px around the gap center
+            changes += session.updateCursor(zm, edge + jitter, y) ? 1 : 0;
+        }
+        return session.currentZone;
+    };
+
+    int churn = 0, steady = 0;
+    run(0, churn);
+    int zone = run(20, steady);
+    std::printf("%-12s %-32s %8d %12d changes\n", "drag", "gap-jitter/radius0", 256, churn);
+    std::printf("%-12s %-32s %8d %12d changes\n", "drag", "gap-jitter/radius20", 256, steady);
+    if (steady != 0 || zone != 0) {
+        Bench::fail("drag", "highlight left the current zone inside the sensitivity radius");
+    }
+    if (churn == 0) {
+        Bench::fail("drag", "jitter over the gap never changed the zone without a radius");
+    }
+
+    // Past the radius the neighbour takes over; in a gap the nearest zone is picked
+    auto config               = std::make_shared<Config>();
+    config->sensitivityRadius = 20;
+    DragSession session;
+    session.config = config;
+    session.setMonitor(nullptr, resolved);
+    session.updateCursor(zm, zones[0].centerX(), y);
+    session.updateCursor(zm, zones[0].pixelX + zones[0].pixelW + 21, y);
+    if (session.currentZone != 1) {
+        Bench::fail("drag", "zone kept beyond the sensitivity radius");
+    }
+    session.setMonitor(nullptr, resolved);
+    session.updateCursor(zm, zones[1].pixelX - 5, y);
+    if (session.currentZone != 1) {
+        Bench::fail("drag", "gap did not fall back to the nearest zone");
+    }
+}
+
+void runDragBench() {
+    MonitorGeometry monitor;
+    monitor.width  = 3840;
+    monitor.height = 2160;
+
+    {
+        ZoneManager zm;
+        checkHysteresis(zm, monitor);
+    }
+
+    // Zig-zag cursor path crossing many zone boundaries
+    std::vector<double> xs, ys;
+    for (int i = 0; i < 512; ++i) {
+        xs.push_back((i * 37 % 3840) + 0.5);
+        ys.push_back((i * 23 % 2160) + 0.5);
+    }
+
+    for (int dim : {3, 10, 30}) {
+        ZoneManager zm;
+        Layout      layout = Bench::makeGrid("drag", dim);
+
+        for (bool span : {false, true}) {
+            DragSession session;
+            session.isDragging     = true;
+            session.isZoneSnapping = true;
+            session.setMonitor(nullptr, zm.resolveLayout("bench", layout, monitor));
+            session.ctrlHeld = span;
+
+            auto runPath = [&] {
+                for (size_t i = 0; i < xs.size(); ++i) {
+                    Bench::doNotOptimize(dragStep(zm, session, xs[i], ys[i]));
+                }
+            };
+
+            runPath();  // warm-up: resolve and first selection
+
+            size_t before = Bench::allocationCount();
+            for (int rep = 0; rep < 8; ++rep) {
+                runPath();
+            }
+            size_t allocs = Bench::allocationCount() - before;
+
+            std::string name = span ? "step/span" : "step/single";
+            Bench::report("drag", name, layout.zones.size(), Bench::measure(runPath, xs.size()));
+
+            if (Bench::allocationCountingEnabled()) {
+                std::printf("%-12s %-32s %8zu %12zu allocs\n", "drag", (name + "/allocs").c_str(),
+                            layout.zones.size(), allocs);
+                if (allocs != 0) {
+                    Bench::fail("drag", name + " allocated in steady state");
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("drag", runDragBench);
@@ -0,0 +1,27 @@
+#include "Fixtures.hpp"
+
+#include <string>
+
+namespace HyprZones::Bench {
+
+Layout makeGrid(std::string_view prefix, int dim) {
+    Layout layout;
+    layout.name       = std::string(prefix) + "-" + std::to_string(dim);
+    layout.generation = 1;
+
+    double cell = 1.0 / dim;
+    for (int r = 0; r < dim; ++r) {
+        for (int c = 0; c < dim; ++c) {
+            Zone zone;
+            zone.index  = static_cast<int>(layout.zones.size());
+            zone.x      = c * cell;
+            zone.y      = r * cell;
+            zone.width  = cell;
+            zone.height = cell;
+            layout.zones.push_back(zone);
+        }
+    }
+    return layout;
+}
+
+}  // namespace HyprZones::Bench
@@ -0,0 +1,15 @@
+#pragma once
+
+// Layouts shared by several bench suites
+
+#include "hyprzones/Layout.hpp"
+
+#include <string_view>
+
+namespace HyprZones::Bench {
+
+// dim x dim equal zones covering the whole monitor, indexed row by row;
+// named "<prefix>-<dim>" with generation 1
+Layout makeGrid(std::string_view prefix, int dim);
+
+}  // namespace HyprZones::Bench
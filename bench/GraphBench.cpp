@@ -0,0 +1,143 @@
+#include "Bench.hpp"
+#include "Fixtures.hpp"
+
+#include "hyprzones/ZoneGraph.hpp"
+#include "hyprzones/ZoneManager.hpp"
+
+#include <vector>
+
+using namespace HyprZones;
+
+namespace {
+
+Zone makeZone(double x, double y, double w, double h) {
+    Zone zone;
+    zone.x      = x;
+    zone.y      = y;
+    zone.width  = w;
+    zone.height = h;
+    return zone;
+}
+
+bool selects(const ZoneSelection& selection, std::vector<int> expected) {
+    return selection.toVector() == expected;
+}
+
+void checkGrid() {
+    auto      zones = Bench::makeGrid("graph", 3).zones;
+    ZoneGraph graph;
+    graph.build(zones);
+
+    // 0 1 2
+    // 3 4 5
+    // 6 7 8
+    if (graph.neighbor(4, Direction::Left) != 3 || graph.neighbor(4, Direction::Right) != 5 ||
+        graph.neighbor(4, Direction::Up) != 1 || graph.neighbor(4, Direction::Down) != 7 ||
+        graph.neighbor(0, Direction::Left) != -1 || graph.neighbor(8, Direction::Down) != -1) {
+        Bench::fail("graph", "wrong grid neighbors");
+    }
+    if (graph.adjacent(4).size() != 4 || graph.adjacent(0).size() != 2) {
+        Bench::fail("graph", "wrong adjacency lists");
+    }
+
+    // Index range 0..4 would also take 2; the rectangle is 0 1 / 3 4
+    ZoneSelection span;
+    graph.spanRect(zones, 0, 4, span);
+    if (!selects(span, {0, 1, 3, 4})) {
+        Bench::fail("graph", "2x2 span is not the rectangle of zones");
+    }
+    graph.spanRect(zones, 7, 5, span);
+    if (!selects(span, {4, 5, 7, 8})) {
+        Bench::fail("graph", "reverse diagonal span is wrong");
+    }
+    graph.spanRect(zones, 2, 2, span);
+    if (!selects(span, {2})) {
+        Bench::fail("graph", "single-zone span is wrong");
+    }
+
+    // A selection moves from its outermost zone
+    ZoneSelection row;
+    row.add(0);
+    row.add(1);
+    if (graph.neighbor(zones, row, Direction::Right) != 2 || graph.neighbor(zones, row, Direction::Left) != -1) {
+        Bench::fail("graph", "selection neighbor not taken from its outermost zone");
+    }
+
+    Direction dir;
+    if (!directionFromName("u", dir) || dir != Direction::Up || !directionFromName("left", dir) ||
+        dir != Direction::Left || directionFromName("x", dir)) {
+        Bench::fail("graph", "direction names misparsed");
+    }
+}
+
+void checkIrregular() {
+    // Left column split at 1/2, right column at 1/3 and 2/3:
+    // 0 | 2
+    //   | 3
+    // 1 |
+    //   | 4
+    std::vector<Zone> zones = {
+        makeZone(0, 0, 0.5, 0.5),
+        makeZone(0, 0.5, 0.5, 0.5),
+        makeZone(0.5, 0, 0.5, 1.0 / 3),
+        makeZone(0.5, 1.0 / 3, 0.5, 1.0 / 3),
+        makeZone(0.5, 2.0 / 3, 0.5, 1.0 / 3),
+    };
+    ZoneGraph graph;
+    graph.build(zones);
+
+    ZoneSelection span;
+    graph.spanRect(zones, 2, 3, span);
+    if (!selects(span, {2, 3})) {
+        Bench::fail("graph", "aligned span picked extra zones");
+    }
+
+    // 0 and 2 overlap 3, which reaches below 0 and pulls in 1, then 4
+    graph.spanRect(zones, 0, 2, span);
+    if (!selects(span, {0, 1, 2, 3, 4})) {
+        Bench::fail("graph", "span not grown to a rectangle of whole zones");
+    }
+
+    // Longest shared edge wins: 0 sees 2 over 1/3 and 3 over 1/6
+    if (graph.neighbor(0, Direction::Right) != 2 || graph.neighbor(3, Direction::Left) != 0 ||
+        graph.neighbor(4, Direction::Left) != 1) {
+        Bench::fail("graph", "neighbor not chosen by the longest shared edge");
+    }
+}
+
+void runGraphBench() {
+    checkGrid();
+    checkIrregular();
+
+    for (int dim : {4, 10, 31}) {
+        auto   zones = Bench::makeGrid("graph", dim).zones;
+        size_t n     = zones.size();
+
+        ZoneGraph graph;
+        Bench::report("graph", "build", n, Bench::measure([&] { graph.build(zones); }));
+
+        double step = Bench::measure(
+            [&] {
+                int zone = 0;
+                for (int i = 0; i < dim - 1; ++i) {
+                    zone = graph.neighbor(zone, Direction::Right);
+                }
+                Bench::doNotOptimize(zone);
+            },
+            dim - 1);
+        Bench::report("graph", "neighbor", n, step);
+
+        // Ctrl-drag from a corner: a 2x2 span and the whole layout
+        ZoneSelection span;
+        Bench::report("graph", "span/2x2", n, Bench::measure([&] { graph.spanRect(zones, 0, dim + 1, span); }));
+        Bench::report("graph", "span/all", n,
+                      Bench::measure([&] { graph.spanRect(zones, 0, static_cast<int>(n) - 1, span); }));
+        if (span.size() != static_cast<int>(n)) {
+            Bench::fail("graph", "corner-to-corner span missed zones");
+        }
+    }
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("graph", runGraphBench);
@@ -0,0 +1,140 @@
+#include "Bench.hpp"
+
+#include "hyprzones/ZoneManager.hpp"
+
+#include <cstdio>
+#include <limits>
+#include <random>
+
+using namespace HyprZones;
+
+namespace {
+
+constexpr double MONITOR_W = 3840;
+constexpr double MONITOR_H = 2160;
+
+// dim x dim tiles plus a 2x2-tile zone anchored at every tile that fits,
+// so every point is covered by several overlapping zones
+Layout makeOverlappingGrid(int dim) {
+    Layout layout;
+    layout.name = "bench-" + std::to_string(dim);
+
+    double cell = 1.0 / dim;
+    for (int r = 0; r < dim; ++r) {
+        for (int c = 0; c < dim; ++c) {
+            Zone zone;
+            zone.index  = static_cast<int>(layout.zones.size());
+            zone.x      = c * cell;
+            zone.y      = r * cell;
+            zone.width  = cell;
+            zone.height = cell;
+            layout.zones.push_back(zone);
+        }
+    }
+    for (int r = 0; r + 1 < dim; ++r) {
+        for (int c = 0; c + 1 < dim; ++c) {
+            Zone zone;
+            zone.index  = static_cast<int>(layout.zones.size());
+            zone.x      = c * cell;
+            zone.y      = r * cell;
+            zone.width  = cell * 2;
+            zone.height = cell * 2;
+            layout.zones.push_back(zone);
+        }
+    }
+    return layout;
+}
+
+// The pre-index implementation, kept as the reference line
+int linearSmallestZoneAtPoint(const Layout& layout, double px, double py) {
+    int    bestIndex = -1;
+    double bestArea  = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < layout.zones.size(); ++i) {
+        const auto& zone = layout.zones[i];
+        if (zone.containsPoint(px, py) && zone.area() < bestArea) {
+            bestArea  = zone.area();
+            bestIndex = static_cast<int>(i);
+        }
+    }
+    return bestIndex;
+}
+
+void runHitTestBench() {
+    constexpr size_t POINTS = 1024;
+
+    std::mt19937                           rng(42);
+    std::uniform_real_distribution<double> xs(0, MONITOR_W);
+    std::uniform_real_distribution<double> ys(0, MONITOR_H);
+
+    std::vector<double> px(POINTS), py(POINTS);
+    for (size_t i = 0; i < POINTS; ++i) {
+        px[i] = xs(rng);
+        py[i] = ys(rng);
+    }
+
+    ZoneManager zm;
+
+    for (int dim : {3, 10, 32, 71}) {
+        Layout layout = makeOverlappingGrid(dim);
+        zm.computeZonePixels(layout, 0, 0, MONITOR_W, MONITOR_H, 0, 0);
+        size_t n = layout.zones.size();
+
+        // Sanity: index and linear scan must agree
+        for (size_t i = 0; i < POINTS; ++i) {
+            if (zm.getSmallestZoneAtPoint(layout, px[i], py[i]) !=
+                linearSmallestZoneAtPoint(layout, px[i], py[i])) {
+                std::printf("hittest: MISMATCH at zones=%zu point=%zu\n", n, i);
+                break;
+            }
+        }
+
+        double indexed = Bench::measure([&] {
+            for (size_t i = 0; i < POINTS; ++i) {
+                Bench::doNotOptimize(zm.getSmallestZoneAtPoint(layout, px[i], py[i]));
+            }
+        }, POINTS);
+        Bench::report("hittest", "smallest/indexed", n, indexed);
+
+        double linear = Bench::measure([&] {
+            for (size_t i = 0; i < POINTS; ++i) {
+                Bench::doNotOptimize(linearSmallestZoneAtPoint(layout, px[i], py[i]));
+            }
+        }, POINTS);
+        Bench::report("hittest", "smallest/linear", n, linear);
+
+        double all = Bench::measure([&] {
+            for (size_t i = 0; i < POINTS; ++i) {
+                Bench::doNotOptimize(zm.getZonesAtPoint(layout, px[i], py[i]));
+            }
+        }, POINTS);
+        Bench::report("hittest", "all/indexed", n, all);
+
+        // Nearest zone for points in gaps: index against the linear fallback
+        Layout gapped = makeOverlappingGrid(dim);
+        zm.computeZonePixels(gapped, 0, 0, MONITOR_W, MONITOR_H, 40, 10);
+        Layout unindexed = gapped;
+        unindexed.spatialIndex.clear();
+        for (size_t i = 0; i < POINTS; ++i) {
+            if (zm.getNearestZone(gapped, px[i], py[i], 20) != zm.getNearestZone(unindexed, px[i], py[i], 20)) {
+                Bench::fail("hittest", "indexed and linear nearest zone disagree");
+                break;
+            }
+        }
+
+        double nearest = Bench::measure([&] {
+            for (size_t i = 0; i < POINTS; ++i) {
+                Bench::doNotOptimize(zm.getNearestZone(gapped, px[i], py[i], 20));
+            }
+        }, POINTS);
+        Bench::report("hittest", "nearest/indexed", n, nearest);
+
+        double build = Bench::measure([&] {
+            zm.computeZonePixels(layout, 0, 0, MONITOR_W, MONITOR_H, 0, 0);
+        });
+        Bench::report("hittest", "computeZonePixels+index", n, build);
+    }
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("hittest", runHitTestBench);
@@ -0,0 +1,118 @@
+#include "Bench.hpp"
+
+#include "hyprzones/LabelCache.hpp"
+
+#include <chrono>
+#include <poll.h>
+#include <string>
+#include <vector>
+
+using namespace HyprZones;
+
+namespace {
+
+// Stand-in for pango: a plate sized from the text
+LabelBitmap fakeRasterize(const LabelKey& key) {
+    LabelBitmap bitmap;
+    bitmap.width  = static_cast<int>(key.text.size()) * 9 * key.scaleKey / 100 + 16;
+    bitmap.height = 20 * key.scaleKey / 100;
+    bitmap.stride = bitmap.width * 4;
+    bitmap.pixels.assign(static_cast<size_t>(bitmap.stride) * bitmap.height, 0x80);
+    return bitmap;
+}
+
+// Wait for the worker, then upload; "textures" are just the byte size
+size_t waitAndUpload(LabelCache<size_t>& cache) {
+    pollfd pfd{cache.readyFd(), POLLIN, 0};
+    poll(&pfd, 1, 1000);
+    return cache.upload([](const LabelBitmap& bitmap) { return bitmap.pixels.size(); });
+}
+
+std::vector<std::string> zoneNames(int count) {
+    std::vector<std::string> names;
+    for (int i = 0; i < count; ++i) {
+        names.push_back("Zone name number " + std::to_string(i));
+    }
+    return names;
+}
+
+void runLabelBench() {
+    auto names = zoneNames(64);
+
+    LabelCache<size_t> cache(fakeRasterize);
+    if (!cache.start()) {
+        Bench::fail("label", "worker did not start");
+        return;
+    }
+
+    // Nothing is drawn until the worker delivered
+    if (cache.find({names[0], 100, 0xffffffff})) {
+        Bench::fail("label", "find() returned a label before it was rasterized");
+    }
+    size_t uploaded = 0;
+    for (int i = 0; i < 100 && uploaded == 0; ++i) {
+        uploaded += waitAndUpload(cache);
+    }
+    const size_t* texture = cache.find({names[0], 100, 0xffffffff});
+    if (!texture || *texture != fakeRasterize({names[0], 100, 0xffffffff}).pixels.size()) {
+        Bench::fail("label", "uploaded label missing or wrong");
+    }
+
+    // Round trip: request to drawable, per label
+    for (const auto& name : names) {
+        cache.find({name, 150, 0xffffffff});
+    }
+    auto   start   = std::chrono::steady_clock::now();
+    size_t pending = names.size();
+    while (pending > 0) {
+        size_t done = waitAndUpload(cache);
+        if (done == 0 && std::chrono::steady_clock::now() - start > std::chrono::seconds(2)) {
+            Bench::fail("label", "worker stalled");
+            break;
+        }
+        pending -= std::min(pending, done);
+    }
+    double roundTrip = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    Bench::report("label", "rasterize/roundtrip", names.size(), roundTrip / static_cast<double>(names.size()));
+
+    // Per-frame cost once everything is uploaded
+    double hit = Bench::measure(
+        [&] {
+            for (const auto& name : names) {
+                Bench::doNotOptimize(cache.find({name, 150, 0xffffffff}));
+            }
+        },
+        names.size());
+    Bench::report("label", "find/hit", names.size(), hit);
+
+    // Budget: far more labels than fit; bytes stay bounded, recent ones survive
+    size_t             labelBytes = fakeRasterize({names[0], 100, 0}).pixels.size();
+    LabelCache<size_t> small(fakeRasterize, labelBytes * 8);
+    small.start();
+    auto many = zoneNames(256);
+    for (int round = 0; round < 4; ++round) {
+        for (const auto& name : many) {
+            small.find({name, 100, 0});
+        }
+        waitAndUpload(small);
+    }
+    for (int i = 0; i < 50 && small.size() > 0; ++i) {
+        waitAndUpload(small);
+    }
+    if (small.bytes() > labelBytes * 8) {
+        Bench::fail("label", "cache exceeded its byte budget");
+    }
+
+    // Results for labels forgotten by clear() are dropped
+    small.clear();
+    small.find({"late", 100, 0});
+    small.clear();
+    waitAndUpload(small);
+    if (small.size() != 0 || small.bytes() != 0) {
+        Bench::fail("label", "stale result uploaded after clear()");
+    }
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("label", runLabelBench);
@@ -0,0 +1,172 @@
+#include "Bench.hpp"
+
+#include "hyprzones/Config.hpp"
+#include "hyprzones/LayoutManager.hpp"
+#include "hyprzones/ZoneManager.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace HyprZones;
+
+namespace {
+
+constexpr int WORKSPACES = 100;
+
+// `monitors` monitors, each with its own layouts for workspace ranges of
+// five, a per-monitor catch-all and a global fallback at the end
+Config makeMappedConfig(int monitors, int zonesPerLayout) {
+    Config config;
+    for (int m = 0; m < monitors; ++m) {
+        std::string monitor = "DP-" + std::to_string(m);
+        for (int first = 1; first <= WORKSPACES; first += 5) {
+            Layout layout;
+            layout.name = monitor + "/" + std::to_string(first);
+            for (int z = 0; z < zonesPerLayout; ++z) {
+                Zone zone;
+                zone.name   = "Zone " + std::to_string(z);
+                zone.x      = static_cast<double>(z) / zonesPerLayout;
+                zone.width  = 1.0 / zonesPerLayout;
+                zone.height = 1.0;
+                layout.zones.push_back(zone);
+            }
+            config.layouts.push_back(std::move(layout));
+            config.mappings.push_back(
+                {monitor, std::to_string(first) + "-" + std::to_string(first + 4), config.layouts.back().name});
+        }
+        config.mappings.push_back({monitor, "*", config.layouts.back().name});
+    }
+    config.mappings.push_back({"*", "*", config.layouts.front().name});
+
+    prepareLayouts(config);
+    LayoutManager::compileMappings(config);
+    return config;
+}
+
+// Unmemoized reference: first compiled mapping that matches
+const Layout* referenceLookup(const Config& config, const std::string& monitor, int workspace) {
+    for (const auto& compiled : config.compiledMappings) {
+        if (compiled.matches(monitor, workspace)) {
+            return &config.layouts[compiled.layoutIdx];
+        }
+    }
+    return config.layouts.empty() ? nullptr : &config.layouts.front();
+}
+
+// Per-monitor switch overrides that monitor's mappings only
+void checkMonitorSwitch() {
+    Config        config = makeMappedConfig(2, 4);
+    LayoutManager manager;
+
+    const std::string& target = config.layouts.back().name;
+    if (manager.switchMonitorLayout(config, "DP-0", "no-such-layout") ||
+        !manager.switchMonitorLayout(config, "DP-0", target)) {
+        Bench::fail("layout", "monitor switch accepted an unknown layout or rejected a known one");
+        return;
+    }
+    const Layout* switched = manager.getLayoutForMonitor(config, "DP-0", 3);
+    const Layout* other    = manager.getLayoutForMonitor(config, "DP-1", 3);
+    if (!switched || switched->name != target || other != referenceLookup(config, "DP-1", 3)) {
+        Bench::fail("layout", "monitor switch not applied to exactly that monitor");
+    }
+}
+
+void runMappingBench() {
+    checkMonitorSwitch();
+
+    for (int monitors : {1, 4, 16, 64}) {
+        Config        config = makeMappedConfig(monitors, 4);
+        LayoutManager manager;
+
+        std::vector<std::string> names;
+        for (int m = 0; m < monitors; ++m) {
+            names.push_back("DP-" + std::to_string(m));
+        }
+        names.push_back("HDMI-A-1");  // unmapped monitor: global fallback
+
+        for (const auto& name : names) {
+            for (int ws = 1; ws <= WORKSPACES + 10; ++ws) {
+                if (manager.getLayoutForMonitor(config, name, ws) != referenceLookup(config, name, ws)) {
+                    Bench::fail("layout", "memoized lookup differs from reference for " + name);
+                    return;
+                }
+            }
+        }
+
+        size_t mappings = config.mappings.size();
+        size_t lookups  = names.size() * WORKSPACES;
+
+        double memo = Bench::measure(
+            [&] {
+                for (const auto& name : names) {
+                    for (int ws = 1; ws <= WORKSPACES; ++ws) {
+                        Bench::doNotOptimize(manager.getLayoutForMonitor(config, name, ws));
+                    }
+                }
+            },
+            lookups);
+        Bench::report("layout", "mapping/memoized", mappings, memo);
+
+        // Every workspace switch right after a reload: memo miss each time
+        double cold = Bench::measure(
+            [&] {
+                for (int ws = 1; ws <= WORKSPACES; ++ws) {
+                    manager.invalidateMappingCache();
+                    Bench::doNotOptimize(manager.getLayoutForMonitor(config, names[ws % names.size()], ws));
+                }
+            },
+            WORKSPACES);
+        Bench::report("layout", "mapping/cold", mappings, cold);
+
+        double compile = Bench::measure([&] { LayoutManager::compileMappings(config); });
+        Bench::report("layout", "compileMappings", mappings, compile);
+    }
+}
+
+void runResolveBench() {
+    constexpr int MONITORS = 8;
+
+    std::vector<MonitorGeometry> monitors;
+    std::vector<std::string>     names;
+    for (int m = 0; m < MONITORS; ++m) {
+        MonitorGeometry geometry;
+        geometry.x           = m * 3840.0;
+        geometry.width       = 3840;
+        geometry.height      = 2160;
+        geometry.reservedTop = 40;
+        monitors.push_back(geometry);
+        names.push_back("DP-" + std::to_string(m));
+    }
+
+    for (int zones : {10, 100, 1000, 10000}) {
+        Config        config = makeMappedConfig(1, zones);
+        const Layout& layout = config.layouts.front();
+        ZoneManager   zm;
+
+        // Per-frame path: every monitor asks for its resolved layout
+        double hit = Bench::measure(
+            [&] {
+                for (int m = 0; m < MONITORS; ++m) {
+                    Bench::doNotOptimize(zm.resolveLayout(names[m], layout, monitors[m]).get());
+                }
+            },
+            MONITORS);
+        Bench::report("layout", "resolve/cached", static_cast<size_t>(zones), hit);
+
+        // Monitor geometry changed (bar toggled, scale change): rebuild pixels and index
+        double rebuild = Bench::measure([&] {
+            monitors[0].reservedTop = monitors[0].reservedTop == 40 ? 41 : 40;
+            Bench::doNotOptimize(zm.resolveLayout(names[0], layout, monitors[0]).get());
+        });
+        Bench::report("layout", "resolve/rebuild", static_cast<size_t>(zones), rebuild);
+    }
+}
+
+void runLayoutBench() {
+    runMappingBench();
+    runResolveBench();
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("layout", runLayoutBench);
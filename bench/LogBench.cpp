@@ -0,0 +1,87 @@
+#include "Bench.hpp"
+
+#include "hyprzones/Log.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace HyprZones;
+
+namespace {
+
+void runLogBench() {
+    std::string path =
+        (std::filesystem::temp_directory_path() / ("hyprzones-bench-" + std::to_string(getpid()) + ".log")).string();
+    if (!Log::start(path)) {
+        Bench::fail("log", "cannot open " + path);
+        return;
+    }
+    Log::setLevel(LogLevel::Info);
+
+    // Several producers at once: every message is either written or counted as dropped
+    constexpr int threads = 4, perThread = 20000;
+    uint64_t      droppedBefore = Log::droppedCount();
+    {
+        std::vector<std::thread> producers;
+        for (int t = 0; t < threads; ++t) {
+            producers.emplace_back([t] {
+                for (int i = 0; i < perThread; ++i) {
+                    HZ_LOG_INFO("producer %d message %d", t, i);
+                    if (i % 256 == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+    }
+    Log::stop();
+
+    size_t        lines = 0;
+    std::ifstream file(path);
+    for (std::string line; std::getline(file, line);) {
+        lines += line.find(" producer ") != std::string::npos;
+    }
+    uint64_t dropped = Log::droppedCount() - droppedBefore;
+    if (lines + dropped != static_cast<size_t>(threads * perThread) || lines == 0) {
+        Bench::fail("log", "lost messages: " + std::to_string(lines) + " written, " + std::to_string(dropped) +
+                               " dropped");
+    }
+
+    // Caller cost while the flusher keeps up: bursts of half a ring, with a
+    // pause between them that is not timed
+    Log::start("/dev/null");
+    using Clock = std::chrono::steady_clock;
+    constexpr int bursts = 2000, burst = 512;
+    int           counter = 0;
+    Clock::duration spent{};
+    for (int b = 0; b < bursts; ++b) {
+        auto start = Clock::now();
+        for (int i = 0; i < burst; ++i) {
+            HZ_LOG_INFO("zone %d snapped to %s", ++counter, "layout");
+        }
+        spent += Clock::now() - start;
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    double ns = std::chrono::duration<double, std::nano>(spent).count() / (bursts * burst);
+    Bench::report("log", "write/info", burst, ns);
+
+    Log::setLevel(LogLevel::Warn);
+    double filtered = Bench::measure([&] { HZ_LOG_INFO("zone %d snapped to %s", ++counter, "layout"); });
+    Bench::report("log", "write/filtered", 1, filtered);
+    Log::setLevel(LogLevel::Info);
+
+    Log::stop();
+    std::filesystem::remove(path);
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("log", runLogBench);
@@ -0,0 +1,107 @@
+#include "Bench.hpp"
+
+#include "hyprzones/MonitorTracker.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace HyprZones;
+
+namespace {
+
+MonitorGeometry makeMonitor(double x, double barHeight) {
+    MonitorGeometry monitor;
+    monitor.x           = x;
+    monitor.width       = 2560;
+    monitor.height      = 1440;
+    monitor.reservedTop = barHeight;
+    return monitor;
+}
+
+void checkOverrides() {
+    Config config;
+    config.monitorOverrides.push_back({"*", 10, -1, -1, -1});
+    config.monitorOverrides.push_back({"DP-1", -1, -1, 30, 30});
+
+    // Exact name wins over "*"; unset edges keep what the compositor reports
+    MonitorGeometry dp1 = applyMonitorOverride(makeMonitor(0, 40), findMonitorOverride(config, "DP-1"));
+    if (dp1.reservedTop != 40 || dp1.reservedLeft != 30 || dp1.reservedRight != 30) {
+        Bench::fail("monitors", "named override not applied edge by edge");
+    }
+    MonitorGeometry hdmi = applyMonitorOverride(makeMonitor(0, 40), findMonitorOverride(config, "HDMI-A-1"));
+    if (hdmi.reservedTop != 10 || hdmi.reservedLeft != 0) {
+        Bench::fail("monitors", "wildcard override not applied");
+    }
+
+    // An override eating the whole monitor is ignored on that axis
+    config.monitorOverrides[1].reservedLeft = 2540;
+    MonitorGeometry full = applyMonitorOverride(makeMonitor(0, 40), findMonitorOverride(config, "DP-1"));
+    if (full.reservedLeft != 0 || full.usableW() != 2560) {
+        Bench::fail("monitors", "override left no usable width");
+    }
+}
+
+void checkChanges() {
+    Config         config;
+    MonitorTracker tracker;
+
+    if (!tracker.update("DP-1", makeMonitor(0, 40), config) || tracker.update("DP-1", makeMonitor(0, 40), config)) {
+        Bench::fail("monitors", "new monitor not reported, or unchanged one reported");
+    }
+    if (!tracker.update("DP-1", makeMonitor(0, 48), config) || tracker.find("DP-1")->reservedTop != 48) {
+        Bench::fail("monitors", "bar height change not reported");
+    }
+
+    // A reported change hidden by an override is not a change
+    config.monitorOverrides.push_back({"DP-1", 30, -1, -1, -1});
+    std::vector<std::string> changed;
+    tracker.update("DP-2", makeMonitor(2560, 40), config);
+    tracker.reapply(config, changed);
+    if (changed != std::vector<std::string>{"DP-1"} || tracker.find("DP-1")->reservedTop != 30) {
+        Bench::fail("monitors", "override change not re-derived for exactly the affected monitor");
+    }
+    if (tracker.update("DP-1", makeMonitor(0, 60), config)) {
+        Bench::fail("monitors", "overridden edge change invalidated the monitor");
+    }
+
+    if (!tracker.remove("DP-2") || tracker.remove("DP-2") || tracker.find("DP-2") || tracker.size() != 1) {
+        Bench::fail("monitors", "removed monitor still tracked");
+    }
+}
+
+void runMonitorBench() {
+    checkOverrides();
+    checkChanges();
+
+    for (size_t count : {1, 4, 16}) {
+        Config config;
+        config.monitorOverrides.push_back({"*", -1, -1, 22, 22});
+
+        MonitorTracker           tracker;
+        std::vector<std::string> names;
+        for (size_t i = 0; i < count; ++i) {
+            names.push_back("DP-" + std::to_string(i));
+            tracker.update(names.back(), makeMonitor(2560.0 * i, 40), config);
+        }
+
+        // Event burst (layers mapped, mode set) that changes nothing: the
+        // refresh every monitor gets, none of which may invalidate zones
+        bool   changed = false;
+        double refresh = Bench::measure([&] {
+            for (size_t i = 0; i < count; ++i) {
+                changed |= tracker.update(names[i], makeMonitor(2560.0 * i, 40), config);
+            }
+        });
+        if (changed) {
+            Bench::fail("monitors", "unchanged refresh reported a change");
+        }
+        Bench::report("monitors", "refresh/unchanged", count, refresh);
+
+        double lookup = Bench::measure([&] { Bench::doNotOptimize(tracker.find(names[count - 1])); });
+        Bench::report("monitors", "lookup", count, lookup);
+    }
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("monitors", runMonitorBench);
@@ -0,0 +1,210 @@
+#include "Bench.hpp"
+#include "Fixtures.hpp"
+
+#include "hyprzones/OverlayMesh.hpp"
+#include "hyprzones/ZoneManager.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace HyprZones;
+
+namespace {
+
+OverlayStyle makeStyle(int borderWidth) {
+    OverlayStyle style;
+    style.inactive    = {0.4f, 0.4f, 0.4f, 0.2f};
+    style.highlight   = {0.0f, 0.4f, 1.0f, 0.3f};
+    style.border      = {0.0f, 0.4f, 1.0f, 0.8f};
+    style.alpha       = 0.8f;
+    style.borderWidth = borderWidth;
+    return style;
+}
+
+void checkMesh(const ResolvedLayout& resolved, const MonitorGeometry& monitor) {
+    const size_t zones = resolved.layout.zones.size();
+    OverlayStyle style = makeStyle(3);
+    OverlayMesh  mesh;
+
+    ZoneSelection highlighted;
+    if (!mesh.update(resolved, monitor.x, monitor.y, monitor.scale, highlighted, style) ||
+        mesh.vertices().size() != zones * OverlayMesh::VERTICES_PER_ZONE) {
+        Bench::fail("overlay", "first update did not build a fill and four border strips per zone");
+        return;
+    }
+
+    uint64_t version = mesh.version();
+    if (mesh.update(resolved, monitor.x, monitor.y, monitor.scale, highlighted, style) || mesh.version() != version) {
+        Bench::fail("overlay", "unchanged frame rebuilt the mesh");
+    }
+
+    // Highlight change: the zone's fill takes the premultiplied highlight color
+    highlighted.add(5);
+    if (!mesh.update(resolved, monitor.x, monitor.y, monitor.scale, highlighted, style) ||
+        mesh.version() != version + 1) {
+        Bench::fail("overlay", "highlight change did not rebuild the mesh");
+    }
+    const OverlayVertex& fill = mesh.vertices()[5 * OverlayMesh::VERTICES_PER_ZONE];
+    float                a    = style.highlight.a * style.alpha;
+    if (std::abs(fill.a - a) > 1e-6f || std::abs(fill.b - style.highlight.b * a) > 1e-6f) {
+        Bench::fail("overlay", "highlighted fill has the wrong color");
+    }
+
+    // Border drawn outside the zone, scaled to framebuffer pixels
+    const Zone&          zone   = resolved.layout.zones[0];
+    const OverlayVertex& top    = mesh.vertices()[6];
+    double               border = std::round(style.borderWidth * monitor.scale);
+    if (top.x != std::round((zone.pixelX - monitor.x) * monitor.scale) - border ||
+        top.y != std::round((zone.pixelY - monitor.y) * monitor.scale) - border) {
+        Bench::fail("overlay", "border not placed outside the zone");
+    }
+
+    style.borderWidth = 0;
+    mesh.update(resolved, monitor.x, monitor.y, monitor.scale, highlighted, style);
+    if (mesh.vertices().size() != zones * 6) {
+        Bench::fail("overlay", "zero-width border still produced vertices");
+    }
+}
+
+DigitAtlasMetrics makeMetrics(float scale) {
+    DigitAtlasMetrics metrics = DigitAtlasMetrics::forScale(scale);
+    metrics.digitWidth        = static_cast<int>(15 * scale);
+    return metrics;
+}
+
+// Number badges: every zone's circle and digits as atlas quads in one mesh
+void checkText(const ResolvedLayout& resolved, const MonitorGeometry& monitor) {
+    const auto&       zones   = resolved.layout.zones;
+    DigitAtlasMetrics metrics = makeMetrics(static_cast<float>(monitor.scale));
+    OverlayTextMesh   text;
+
+    size_t quads = 0;
+    for (size_t i = 0; i < zones.size(); ++i) {
+        quads += 1 + std::to_string(i + 1).size();
+    }
+    if (!text.update(resolved, monitor.x, monitor.y, monitor.scale, metrics) ||
+        text.vertices().size() != quads * OverlayTextMesh::VERTICES_PER_QUAD) {
+        Bench::fail("overlay", "badges not built as a circle and one quad per digit");
+        return;
+    }
+
+    uint64_t version = text.version();
+    if (text.update(resolved, monitor.x, monitor.y, monitor.scale, metrics) || text.version() != version) {
+        Bench::fail("overlay", "unchanged frame rebuilt the badges");
+    }
+
+    // Same placement and texture coordinates as composeBadge's quads
+    BadgeQuads expected;
+    double     centerX = (zones[0].pixelX - monitor.x + zones[0].pixelW / 2) * monitor.scale;
+    double     centerY = (zones[0].pixelY - monitor.y + zones[0].pixelH / 2) * monitor.scale;
+    composeBadge(metrics, 1, centerX, centerY, expected);
+    const OverlayTexVertex& circle = text.vertices()[0];
+    const OverlayTexVertex& digit  = text.vertices()[OverlayTextMesh::VERTICES_PER_QUAD];
+    if (std::abs(circle.x - expected[0].dst.x) > 1e-3 || std::abs(circle.y - expected[0].dst.y) > 1e-3 ||
+        circle.u != 0.0f || circle.v != 0.0f ||
+        std::abs(digit.u - metrics.digit(1).x / metrics.width()) > 1e-6) {
+        Bench::fail("overlay", "badge quads don't match the atlas cells");
+    }
+
+    // Labels follow the badges, one quad each, below the badge
+    OverlayLabel labels[] = {{0, 80, 20}, {3, 60, 20}};
+    if (!text.update(resolved, monitor.x, monitor.y, monitor.scale, metrics, labels) ||
+        text.badgeVertexCount() != quads * OverlayTextMesh::VERTICES_PER_QUAD ||
+        text.vertices().size() != (quads + 2) * OverlayTextMesh::VERTICES_PER_QUAD) {
+        Bench::fail("overlay", "labels not appended as one quad each after the badges");
+        return;
+    }
+    const OverlayTexVertex& label = text.vertices()[text.badgeVertexCount()];
+    if (std::abs(label.x - (centerX - 40)) > 1e-3 ||
+        std::abs(label.y - (centerY + metrics.badgeSize / 2.0 + 4 * monitor.scale)) > 1e-3 || label.u != 0.0f ||
+        label.v != 0.0f) {
+        Bench::fail("overlay", "label not centred below its badge");
+    }
+    version = text.version();
+    if (text.update(resolved, monitor.x, monitor.y, monitor.scale, metrics, labels) || text.version() != version) {
+        Bench::fail("overlay", "unchanged labels rebuilt the text mesh");
+    }
+    if (!text.update(resolved, monitor.x, monitor.y, monitor.scale, metrics, std::span(labels, 1))) {
+        Bench::fail("overlay", "a label going away did not rebuild the text mesh");
+    }
+
+    // Numbers switched off: labels only, centred in their zones
+    if (!text.update(resolved, monitor.x, monitor.y, monitor.scale, DigitAtlasMetrics{}, labels) ||
+        text.badgeVertexCount() != 0 || text.vertices().size() != 2 * OverlayTextMesh::VERTICES_PER_QUAD ||
+        std::abs(text.vertices()[0].y - (centerY - 10)) > 1e-3) {
+        Bench::fail("overlay", "badges drawn without an atlas");
+    }
+}
+
+void runOverlayBench() {
+    MonitorGeometry monitor;
+    monitor.x      = 1920;
+    monitor.width  = 3840;
+    monitor.height = 2160;
+    monitor.scale  = 1.5;
+
+    ZoneManager zm;
+    for (int dim : {4, 10, 32}) {
+        auto resolved = zm.buildResolvedLayout(Bench::makeGrid("overlay", dim), monitor);
+        if (dim == 4) {
+            checkMesh(*resolved, monitor);
+            checkText(*resolved, monitor);
+        }
+
+        OverlayStyle  style = makeStyle(3);
+        OverlayMesh   mesh;
+        ZoneSelection highlight[2];
+        highlight[0].add(1);
+        highlight[1].add(2);
+        // A name label on every zone
+        std::vector<OverlayLabel> labels;
+        for (size_t i = 0; i < resolved->layout.zones.size(); ++i) {
+            labels.push_back({static_cast<int>(i), 80, 20});
+        }
+
+        OverlayTextMesh   text;
+        DigitAtlasMetrics metrics = makeMetrics(static_cast<float>(monitor.scale));
+        mesh.update(*resolved, monitor.x, monitor.y, monitor.scale, highlight[0], style);
+        text.update(*resolved, monitor.x, monitor.y, monitor.scale, metrics, labels);
+
+        // Frame with nothing changed: compare and reuse
+        auto unchanged = [&] {
+            Bench::doNotOptimize(mesh.update(*resolved, monitor.x, monitor.y, monitor.scale, highlight[0], style));
+            Bench::doNotOptimize(text.update(*resolved, monitor.x, monitor.y, monitor.scale, metrics, labels));
+        };
+        // Frame after a zone change: rebuild into the existing buffer
+        int  flip    = 0;
+        auto rebuild = [&] {
+            flip ^= 1;
+            Bench::doNotOptimize(mesh.update(*resolved, monitor.x, monitor.y, monitor.scale, highlight[flip], style));
+        };
+
+        size_t zones = resolved->layout.zones.size();
+        Bench::report("overlay", "frame/unchanged", zones, Bench::measure(unchanged));
+        Bench::report("overlay", "frame/rebuild", zones, Bench::measure(rebuild));
+        Bench::report("overlay", "text/rebuild", zones, Bench::measure([&] {
+            text.invalidate();
+            Bench::doNotOptimize(text.update(*resolved, monitor.x, monitor.y, monitor.scale, metrics, labels));
+        }));
+
+        if (Bench::allocationCountingEnabled()) {
+            size_t before = Bench::allocationCount();
+            for (int i = 0; i < 64; ++i) {
+                unchanged();
+                rebuild();
+            }
+            size_t allocs = Bench::allocationCount() - before;
+            std::printf("%-12s %-32s %8zu %12zu allocs\n", "overlay", "frame/allocs", zones, allocs);
+            if (allocs != 0) {
+                Bench::fail("overlay", "overlay frames allocated in steady state");
+            }
+        }
+    }
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("overlay", runOverlayBench);
@@ -0,0 +1,171 @@
+#include "Bench.hpp"
+
+#include "hyprzones/Config.hpp"
+#include "hyprzones/DragInput.hpp"
+#include "hyprzones/Trace.hpp"
+#include "hyprzones/TraceReplay.hpp"
+#include "hyprzones/ZoneManager.hpp"
+
+#include <filesystem>
+#include <linux/input-event-codes.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace HyprZones;
+
+namespace {
+
+constexpr int MONITORS       = 2;
+constexpr int CALLS_PER_DRAG = 75;  // input calls made by recordDrags per drag
+
+// Live side of the recording: two side-by-side monitors sharing a 3x2 grid
+class BenchHost : public DragHost {
+  public:
+    BenchHost() {
+        m_layout.name       = "grid";
+        m_layout.generation = 1;
+        for (int r = 0; r < 2; ++r) {
+            for (int c = 0; c < 3; ++c) {
+                Zone zone;
+                zone.index  = static_cast<int>(m_layout.zones.size());
+                zone.x      = c / 3.0;
+                zone.y      = r / 2.0;
+                zone.width  = 1 / 3.0;
+                zone.height = 0.5;
+                m_layout.zones.push_back(zone);
+            }
+        }
+        for (int m = 0; m < MONITORS; ++m) {
+            m_monitors[m].x           = m * 2560.0;
+            m_monitors[m].width       = 2560;
+            m_monitors[m].height      = 1440;
+            m_monitors[m].reservedTop = 30;
+        }
+    }
+
+    void* monitorAt(double x, double) override { return &m_monitors[x < 2560 ? 0 : 1]; }
+
+    std::shared_ptr<const ResolvedLayout> resolveLayout(void* monitor, const Config&) override {
+        int m = static_cast<int>(static_cast<MonitorGeometry*>(monitor) - m_monitors);
+        return m_zoneManager.resolveLayout("DP-" + std::to_string(m), m_layout, m_monitors[m]);
+    }
+
+    void damage(void*) override {}
+    void damageRegion(void*, const DamageRegion&) override {}
+    void showOverlay() override {}
+    void hideOverlay() override {}
+
+    void snapWindow(void*, const std::string& layoutName, const ZoneSelection& zones,
+                    const GeometryBox& box) override {
+        snaps.push_back({0, layoutName, zones.toVector(), box});
+    }
+
+    void releaseWindow(void*) override {}
+
+    std::vector<TraceSnap> snaps;  // window ids are filled in by the trace only
+
+  private:
+    Layout          m_layout;
+    MonitorGeometry m_monitors[MONITORS];
+    ZoneManager     m_zoneManager;
+};
+
+// Drags across both monitors; every third one without the modifier (no snap),
+// every fourth one spanning zones with CTRL, hover motion in between
+void recordDrags(DragInput& input, const std::shared_ptr<const Config>& config, int drags) {
+    static int windows[3];
+    for (int d = 0; d < drags; ++d) {
+        void*    window = &windows[d % 3];
+        uint32_t mods   = 0;
+        if (d % 3 != 2) {
+            mods = d % 4 == 3 ? MOD_SHIFT | MOD_CTRL : MOD_SHIFT;
+        }
+
+        for (int i = 0; i < 8; ++i) {
+            input.motion(100.0 + i * 40, 700, 0, nullptr, config);
+        }
+        input.button(BTN_LEFT, true);
+        for (int i = 0; i < 64; ++i) {
+            double x = (d * 311 + i * 73) % 5120 + 0.5;
+            double y = (d * 157 + i * 29) % 1440 + 0.5;
+            input.motion(x, y, mods, window, config);
+        }
+        input.button(BTN_LEFT, false);
+        input.motion(5000, 1000, 0, nullptr, config);
+    }
+}
+
+void runReplayBench() {
+    std::string path =
+        (std::filesystem::temp_directory_path() / ("hyprzones-bench-" + std::to_string(getpid()) + ".trace")).string();
+    auto config = std::make_shared<const Config>();
+
+    BenchHost     host;
+    DragSession   session;
+    ZoneManager   zm;
+    DragInput     input(session, zm, host);
+    TraceRecorder recorder;
+
+    std::string error;
+    if (!recorder.start(path, &error)) {
+        Bench::fail("replay", error);
+        return;
+    }
+    input.setRecorder(&recorder);
+    recordDrags(input, config, 48);
+    input.setRecorder(nullptr);
+    size_t recorded = recorder.eventCount();
+    if (!recorder.stop(&error)) {
+        Bench::fail("replay", error);
+        return;
+    }
+
+    Trace trace;
+    if (!readTrace(path, trace, &error)) {
+        Bench::fail("replay", error);
+        std::filesystem::remove(path);
+        return;
+    }
+
+    ReplayResult result = replayTrace(trace);
+    if (result.events.size() != recorded) {
+        Bench::fail("replay", "replayed " + std::to_string(result.events.size()) + " of " +
+                                  std::to_string(recorded) + " recorded events");
+    }
+    if (trace.snaps.size() != host.snaps.size() || result.mismatches != 0) {
+        Bench::fail("replay", "replayed drop decisions differ from the recorded ones");
+    }
+    for (size_t i = 0; i < trace.snaps.size() && i < host.snaps.size(); ++i) {
+        if (trace.snaps[i].zones != host.snaps[i].zones || trace.snaps[i].box != host.snaps[i].box) {
+            Bench::fail("replay", "recorded snap " + std::to_string(i) + " differs from the live one");
+            break;
+        }
+    }
+
+    // Recording overhead on the live path, relative to the same drags unrecorded
+    TraceRecorder sink;
+    sink.start("/dev/null");
+    input.setRecorder(&sink);
+    double withRecorder = Bench::measure([&] { recordDrags(input, config, 4); }, 4 * CALLS_PER_DRAG);
+    input.setRecorder(nullptr);
+    sink.stop();
+    double without = Bench::measure([&] { recordDrags(input, config, 4); }, 4 * CALLS_PER_DRAG);
+    Bench::report("replay", "input/recorded", CALLS_PER_DRAG, withRecorder);
+    Bench::report("replay", "input/plain", CALLS_PER_DRAG, without);
+
+    size_t records = trace.records.size();
+    double read    = Bench::measure([&] {
+        Trace copy;
+        Bench::doNotOptimize(readTrace(path, copy));
+    }, records);
+    Bench::report("replay", "readTrace/record", records, read);
+    std::filesystem::remove(path);
+
+    double replay = Bench::measure([&] { Bench::doNotOptimize(replayTrace(trace).mismatches); }, records);
+    Bench::report("replay", "replay/record", records, replay);
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("replay", runReplayBench);
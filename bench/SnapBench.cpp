@@ -0,0 +1,367 @@
+#include "Bench.hpp"
+
+#include "hyprzones/Config.hpp"
+#include "hyprzones/DragInput.hpp"
+#include "hyprzones/DragSession.hpp"
+#include "hyprzones/LayoutManager.hpp"
+#include "hyprzones/WindowGeometryBackend.hpp"
+#include "hyprzones/WindowSnapper.hpp"
+#include "hyprzones/ZoneManager.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <linux/input-event-codes.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace HyprZones;
+
+namespace {
+
+void* fakeWindow(size_t i) {
+    return reinterpret_cast<void*>(uintptr_t{0x1000} + i * 64);
+}
+
+// A drop on two adjacent zones places the window on their combined box
+void checkDrop(ZoneManager& zm, const Layout& layout) {
+    WindowSnapper       snapper(zm);
+    MockGeometryBackend backend;
+
+    ZoneSelection span;
+    span.add(1);
+    span.add(2);
+    GeometryRequest request;
+    if (!snapper.snapToZones(fakeWindow(0), layout, span, request) || !backend.apply(request.window, request.box)) {
+        Bench::fail("snap", "drop on two zones was not placed");
+        return;
+    }
+
+    const Zone& left  = layout.zones[1];
+    const Zone& right = layout.zones[2];
+    GeometryBox expected{left.pixelX, left.pixelY, right.pixelX + right.pixelW - left.pixelX, left.pixelH};
+    if (backend.applied().size() != 1 || backend.applied()[0].window != fakeWindow(0) ||
+        backend.applied()[0].box != expected) {
+        Bench::fail("snap", "drop did not apply the combined zone box");
+    }
+}
+
+// applyBatch reaches the backend once, with every request in order
+void checkBatch(ZoneManager& zm, const Layout& layout) {
+    WindowSnapper                snapper(zm);
+    MockGeometryBackend          backend;
+    std::vector<GeometryRequest> batch;
+    for (size_t i = 0; i < 16; ++i) {
+        ZoneSelection zones;
+        zones.set(static_cast<int>(i % layout.zones.size()));
+        GeometryRequest request;
+        if (snapper.snapToZones(fakeWindow(i), layout, zones, request)) {
+            batch.push_back(request);
+        }
+    }
+
+    if (batch.size() != 16 || backend.applyBatch(batch) != batch.size() || backend.batchCount() != 1 ||
+        backend.applied() != batch) {
+        Bench::fail("snap", "batch not applied once with all requests in order");
+    }
+}
+
+// A window that is gone stops at the snapper, and a null request in a
+// batch is reported as not placed without holding up the others
+void checkNullWindow(ZoneManager& zm, const Layout& layout) {
+    WindowSnapper       snapper(zm);
+    MockGeometryBackend backend;
+
+    ZoneSelection zones;
+    zones.set(0);
+    GeometryRequest request;
+    if (snapper.snapToZones(nullptr, layout, zones, request) || request.window) {
+        Bench::fail("snap", "null window produced a placement");
+    }
+
+    std::vector<GeometryRequest> batch = {{fakeWindow(0), {0, 0, 10, 10}},
+                                          {nullptr, {10, 0, 10, 10}},
+                                          {fakeWindow(2), {20, 0, 10, 10}}};
+    if (backend.applyBatch(batch) != 2 || backend.batchCount() != 1 || backend.applied().size() != 3) {
+        Bench::fail("snap", "null window in a batch counted as placed");
+    }
+}
+
+// Layouts the resnap checks switch between: four columns, a 2x2 grid and
+// two halves, cycled in that order
+Config makeSwitchConfig() {
+    Config config;
+    auto addLayout = [&](const std::string& name, int columns, int rows) {
+        Layout layout;
+        layout.name = name;
+        for (int r = 0; r < rows; ++r) {
+            for (int c = 0; c < columns; ++c) {
+                Zone zone;
+                zone.index  = static_cast<int>(layout.zones.size());
+                zone.x      = static_cast<double>(c) / columns;
+                zone.y      = static_cast<double>(r) / rows;
+                zone.width  = 1.0 / columns;
+                zone.height = 1.0 / rows;
+                layout.zones.push_back(zone);
+            }
+        }
+        config.layouts.push_back(std::move(layout));
+    };
+    addLayout("columns", 4, 1);
+    addLayout("grid", 2, 2);
+    addLayout("halves", 2, 1);
+    config.activeLayout = "columns";
+    prepareLayouts(config);
+    return config;
+}
+
+GeometryBox zoneBox(ZoneManager& zm, const Layout& layout, std::initializer_list<int> indices) {
+    ZoneSelection zones;
+    for (int index : indices) {
+        zones.add(index);
+    }
+    GeometryBox box;
+    zm.getCombinedZoneBox(layout, zones, box.x, box.y, box.w, box.h);
+    return box;
+}
+
+// What the plugin does on the frame after a (coalesced) switch: every
+// remembered window re-placed on the current layout, one backend call
+std::shared_ptr<const ResolvedLayout> resnapAll(ZoneManager& zm, LayoutManager& manager, const Config& config,
+                                                const MonitorGeometry& monitor, WindowSnapper& snapper,
+                                                MockGeometryBackend& backend) {
+    auto resolved = zm.buildResolvedLayout(*manager.getLayoutForMonitor(config, "DP-1", 1), monitor);
+
+    std::vector<GeometryRequest> batch;
+    snapper.forEachWindow([&](void* window, WindowMemory&) {
+        GeometryRequest request;
+        if (snapper.resnap(window, "DP-1", resolved->layout, request)) {
+            batch.push_back(request);
+        }
+    });
+    snapper.forgetReleased();
+    backend.applyBatch(batch);
+    return resolved;
+}
+
+const GeometryRequest* findApplied(const MockGeometryBackend& backend, void* window) {
+    for (const auto& request : backend.applied()) {
+        if (request.window == window) {
+            return &request;
+        }
+    }
+    return nullptr;
+}
+
+// Windows on zones 0, 1-2 and 3 of the columns layout, followed through a
+// switch, a held cycle hotkey, a switch to fewer zones and back, and a
+// reload. The memory keeps what the user chose throughout.
+void checkResnap(const MonitorGeometry& monitor) {
+    ZoneManager         zm;
+    LayoutManager       manager;
+    Config              config = makeSwitchConfig();
+    WindowSnapper       snapper(zm);
+    MockGeometryBackend backend;
+
+    const GeometryBox original{100, 100, 800, 600};
+    auto              remember = [&](size_t window, std::initializer_list<int> indices) {
+        ZoneSelection zones;
+        for (int index : indices) {
+            zones.add(index);
+        }
+        snapper.rememberWindow(fakeWindow(window), "DP-1", "columns", zones, original.x, original.y, original.w,
+                               original.h);
+    };
+    remember(0, {0});
+    remember(1, {1, 2});
+    remember(2, {3});
+
+    auto placedOn = [&](size_t window, const GeometryBox& box) {
+        const GeometryRequest* request = findApplied(backend, fakeWindow(window));
+        return request && request->box == box;
+    };
+
+    // Layout switch: same zone count, every window keeps its zone indices
+    manager.switchLayout(config, "grid");
+    auto grid = resnapAll(zm, manager, config, monitor, snapper, backend);
+    if (backend.batchCount() != 1 || backend.applied().size() != 3 ||
+        !placedOn(0, zoneBox(zm, grid->layout, {0})) || !placedOn(1, zoneBox(zm, grid->layout, {1, 2})) ||
+        !placedOn(2, zoneBox(zm, grid->layout, {3})) || snapper.getMemory(fakeWindow(1))->layoutName != "columns") {
+        Bench::fail("snap", "layout switch did not re-place every window on its zones in one batch");
+    }
+
+    // Held cycle hotkey: grid -> halves -> columns before the next frame,
+    // applied once on the final layout
+    backend.clear();
+    manager.cycleLayout(config, 1);
+    manager.cycleLayout(config, 1);
+    auto columns = resnapAll(zm, manager, config, monitor, snapper, backend);
+    if (columns->layout.name != "columns" || backend.batchCount() != 1 || backend.applied().size() != 3 ||
+        !placedOn(1, zoneBox(zm, columns->layout, {1, 2})) || !placedOn(2, zoneBox(zm, columns->layout, {3}))) {
+        Bench::fail("snap", "repeated cycles not coalesced into one batch on the final layout");
+    }
+
+    // Shrink to two zones: zone 2 dropped from the span, the window on zone
+    // 3 goes back to its original geometry but stays remembered
+    backend.clear();
+    manager.switchLayout(config, "halves");
+    auto halves = resnapAll(zm, manager, config, monitor, snapper, backend);
+    if (backend.batchCount() != 1 || backend.applied().size() != 3 ||
+        !placedOn(0, zoneBox(zm, halves->layout, {0})) || !placedOn(1, zoneBox(zm, halves->layout, {1})) ||
+        !placedOn(2, original) || snapper.memorySize() != 3) {
+        Bench::fail("snap", "shrink did not carry zones by index and keep the window with none left");
+    }
+
+    // Back to four columns: the span and zone 3 come back as chosen
+    backend.clear();
+    manager.switchLayout(config, "columns");
+    columns = resnapAll(zm, manager, config, monitor, snapper, backend);
+    const WindowMemory* spanning = snapper.getMemory(fakeWindow(1));
+    if (backend.applied().size() != 3 || !placedOn(1, zoneBox(zm, columns->layout, {1, 2})) ||
+        !placedOn(2, zoneBox(zm, columns->layout, {3})) || !spanning || spanning->zones.size() != 2) {
+        Bench::fail("snap", "switching back did not restore the chosen zones");
+    }
+
+    // Reload that deletes zone 0 and shifts the rest down: restoreAll places
+    // the survivors on their new indices and releases the other
+    int                          oldToNew[] = {-1, 0, 1, 2};
+    std::vector<GeometryRequest> restored;
+    snapper.remapZones("columns", oldToNew);
+    snapper.restoreAll(columns->layout, restored);
+    if (restored.size() != 3 || snapper.memorySize() != 2 || snapper.getMemory(fakeWindow(0)) ||
+        std::find(restored.begin(), restored.end(), GeometryRequest{fakeWindow(0), original}) == restored.end() ||
+        std::find(restored.begin(), restored.end(),
+                  GeometryRequest{fakeWindow(1), zoneBox(zm, columns->layout, {0, 1})}) == restored.end() ||
+        std::find(restored.begin(), restored.end(),
+                  GeometryRequest{fakeWindow(2), zoneBox(zm, columns->layout, {2})}) == restored.end()) {
+        Bench::fail("snap", "restoreAll did not follow the remapped zones");
+    }
+}
+
+// Drag host on one monitor that remembers drops the way the plugin does
+class SnapHost : public DragHost {
+  public:
+    SnapHost(WindowSnapper& snapper, std::shared_ptr<const ResolvedLayout> resolved)
+        : m_snapper(snapper), m_resolved(std::move(resolved)) {}
+
+    void* monitorAt(double, double) override { return this; }
+
+    std::shared_ptr<const ResolvedLayout> resolveLayout(void*, const Config&) override { return m_resolved; }
+
+    void damage(void*) override {}
+    void damageRegion(void*, const DamageRegion&) override {}
+    void showOverlay() override {}
+    void hideOverlay() override {}
+
+    void snapWindow(void* window, const std::string& layoutName, const ZoneSelection& zones,
+                    const GeometryBox&) override {
+        m_snapper.rememberWindow(window, "DP-1", layoutName, zones, 100, 100, 800, 600);
+    }
+
+    void releaseWindow(void* window) override { m_snapper.unsnap(window); }
+
+  private:
+    WindowSnapper&                        m_snapper;
+    std::shared_ptr<const ResolvedLayout> m_resolved;
+};
+
+// A window dropped on a zone is remembered; dragged again without the
+// modifier, or found on another monitor, it is no longer re-snapped
+void checkHandMoves(ZoneManager& zm, const MonitorGeometry& monitor, const Layout& layout) {
+    WindowSnapper snapper(zm);
+    SnapHost      host(snapper, zm.buildResolvedLayout(layout, monitor));
+    DragSession   session;
+    DragInput     input(session, zm, host);
+    auto          config = std::make_shared<const Config>();
+    const Layout& placed = host.resolveLayout(nullptr, *config)->layout;
+
+    // Drag from zone 0 to zone 3, with or without the snap modifier
+    auto drag = [&](uint32_t mods) {
+        input.button(BTN_LEFT, true);
+        input.motion(monitor.width * 0.1, monitor.height * 0.5, mods, fakeWindow(0), config);
+        input.motion(monitor.width * 0.9, monitor.height * 0.5, mods, fakeWindow(0), config);
+        input.button(BTN_LEFT, false);
+    };
+
+    drag(MOD_SHIFT);
+    const WindowMemory* memory = snapper.getMemory(fakeWindow(0));
+    if (!memory || memory->zones.toVector() != std::vector<int>{3}) {
+        Bench::fail("snap", "drop with the modifier was not remembered");
+        return;
+    }
+
+    GeometryRequest request;
+    drag(0);
+    if (snapper.getMemory(fakeWindow(0)) || snapper.resnap(fakeWindow(0), "DP-1", placed, request)) {
+        Bench::fail("snap", "window dragged by hand was still re-snapped");
+    }
+
+    drag(MOD_SHIFT);
+    if (snapper.resnap(fakeWindow(0), "DP-2", placed, request) || snapper.forgetReleased() != 1 ||
+        snapper.memorySize() != 0) {
+        Bench::fail("snap", "window moved to another monitor was not released");
+    }
+}
+
+// Snap latency minus the compositor: combined zone box plus backend apply,
+// measured against the recording mock backend
+void runSnapBench() {
+    Layout layout;
+    layout.name       = "snap";
+    layout.generation = 1;
+    for (int c = 0; c < 4; ++c) {
+        Zone zone;
+        zone.index = c;
+        zone.x     = c * 0.25;
+        zone.width = 0.25;
+        layout.zones.push_back(zone);
+    }
+
+    MonitorGeometry monitor;
+    monitor.width  = 3840;
+    monitor.height = 2160;
+
+    ZoneManager zm;
+    auto        resolved = zm.resolveLayout("bench", layout, monitor);
+
+    checkDrop(zm, resolved->layout);
+    checkBatch(zm, resolved->layout);
+    checkNullWindow(zm, resolved->layout);
+    checkResnap(monitor);
+    checkHandMoves(zm, monitor, layout);
+
+    ZoneSelection span;
+    span.add(1);
+    span.add(2);
+
+    MockGeometryBackend backend;
+
+    double single = Bench::measure([&] {
+        backend.clear();
+        double x, y, w, h;
+        zm.getCombinedZoneBox(resolved->layout, span, x, y, w, h);
+        backend.apply(fakeWindow(0), {x, y, w, h});
+    });
+    Bench::report("snap", "drop/mock", 1, single);
+
+    for (size_t windows : {10, 100, 1000}) {
+        std::vector<GeometryRequest> batch(windows);
+        double batched = Bench::measure([&] {
+            backend.clear();
+            for (size_t i = 0; i < windows; ++i) {
+                ZoneSelection zones;
+                zones.set(static_cast<int>(i % layout.zones.size()));
+                double x, y, w, h;
+                zm.getCombinedZoneBox(resolved->layout, zones, x, y, w, h);
+                batch[i] = {fakeWindow(i), {x, y, w, h}};
+            }
+            backend.applyBatch(batch);
+        }, windows);
+        Bench::report("snap", "batch/mock", windows, batched);
+    }
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("snap", runSnapBench);
@@ -0,0 +1,31 @@
+#include "Bench.hpp"
+
+#include "hyprzones/Stats.hpp"
+
+using namespace HyprZones;
+
+namespace {
+
+void runStatsBench() {
+    // What every instrumented callback pays: two clock reads and a bucket increment
+    double probe = Bench::measure([] { ScopedProbe scoped(Probe::MouseMove); });
+    Bench::report("stats", "scoped-probe", 1, probe);
+
+    double counter = Bench::measure([] { g_stats.count(Counter::DamageRequests); });
+    Bench::report("stats", "counter", 1, counter);
+
+    LatencyHistogram histogram;
+    for (uint64_t ns = 1; ns <= 100000; ++ns) {
+        histogram.record(ns);
+    }
+    // Bucket upper bounds overestimate by at most 25%
+    uint64_t p50 = histogram.percentile(0.5), p99 = histogram.percentile(0.99);
+    if (p50 < 50000 || p50 > 62500 || p99 < 99000 || p99 > 100000 || histogram.max() != 100000) {
+        Bench::fail("stats", "histogram percentiles out of range");
+    }
+    g_stats.reset();
+}
+
+}  // namespace
+
+HZ_BENCH_SUITE("stats", runStatsBench);
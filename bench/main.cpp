@@ -0,0 +1,58 @@
+#include "Bench.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace HyprZones::Bench {
+
+struct Suite {
+    const char* name;
+    SuiteFn     fn;
+};
+
+static std::vector<Suite>& suites() {
+    static std::vector<Suite> s;
+    return s;
+}
+
+Registrar::Registrar(const char* name, SuiteFn fn) {
+    suites().push_back({name, fn});
+}
+
+void report(std::string_view suite, std::string_view name, size_t param, double nsPerOp) {
+    std::printf("%-12.*s %-32.*s %8zu %12.1f ns/op\n",
+                static_cast<int>(suite.size()), suite.data(),
+                static_cast<int>(name.size()), name.data(),
+                param, nsPerOp);
+}
+
+static bool g_failed = false;
+
+void fail(std::string_view suite, std::string_view message) {
+    g_failed = true;
+    std::printf("%-12.*s FAIL: %.*s\n",
+                static_cast<int>(suite.size()), suite.data(),
+                static_cast<int>(message.size()), message.data());
+}
+
+}  // namespace HyprZones::Bench
+
+// Usage: hyprzones_bench [suite...]   (no arguments runs every suite)
+int main(int argc, char** argv) {
+    using namespace HyprZones::Bench;
+
+    std::printf("%-12s %-32s %8s %15s\n", "suite", "case", "n", "time");
+
+    for (const auto& suite : suites()) {
+        bool selected = argc < 2;
+        for (int i = 1; i < argc && !selected; ++i) {
+            selected = std::strcmp(argv[i], suite.name) == 0;
+        }
+        if (selected) {
+            suite.fn();
+        }
+    }
+
+    return g_failed ? 1 : 0;
+}
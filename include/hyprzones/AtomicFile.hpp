@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace HyprZones {
+
+// Replace path with data so readers see either the old or the new file,
+// never a truncated one: write a temp file next to it, fsync, rename, fsync
+// the directory. Creates missing parent directories. On failure the old
+// file is untouched and error (if given) says why.
+// durable = false skips the fsyncs (rebuildable files such as caches).
+bool writeFileAtomic(const std::string& path, std::string_view data, std::string* error = nullptr,
+                     bool durable = true);
+
+}  // namespace HyprZones
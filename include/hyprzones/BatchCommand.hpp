@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace HyprZones {
+
+// hyprctl hyprzones:batch: operations separated by ';' or newlines, run in
+// one pass with the re-layout and redraw they need applied once at the end.
+//
+//   moveto <address> <zone>[-<zone>] [<layout>]   window by address ("0x..."
+//                                                 or "address:0x...")
+//   layout [<monitor>] <layout>                   switch one monitor, or the default
+//   show | hide                                   zone overlay
+//
+// Tokens are split on whitespace; "double quotes" keep spaces in names.
+enum class BatchOp : uint8_t {
+    Invalid,
+    MoveTo,
+    Layout,
+    Show,
+    Hide,
+};
+
+struct BatchOperation {
+    BatchOp     op        = BatchOp::Invalid;
+    uintptr_t   window    = 0;
+    int         zoneStart = -1;
+    int         zoneEnd   = -1;  // == zoneStart for a single zone
+    std::string monitor;         // layout: empty = default layout
+    std::string layout;          // moveto: empty = the monitor's current layout
+    std::string error;           // parse or execution error, empty = ok
+};
+
+const char* batchOpName(BatchOp op);
+
+// Unparseable operations come back as BatchOp::Invalid (or with error set)
+// and are reported without stopping the rest of the batch
+std::vector<BatchOperation> parseBatch(std::string_view text);
+
+// [{"op":"moveto","ok":true},{"op":"layout","ok":false,"error":"..."},...]
+std::string formatBatchResults(const std::vector<BatchOperation>& operations);
+
+}  // namespace HyprZones
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 namespace HyprZones {
 
@@ -15,6 +16,10 @@ struct Color {
     }
 
     static Color fromHex(const std::string& hex);
+
+    // Parse "#rrggbb", "#rrggbbaa", "rgba(rrggbbaa)", "rgb(r, g, b)" or
+    // "rgba(r, g, b, a)" (channels 0-255, alpha 0-1). Returns false on malformed input.
+    static bool parse(std::string_view text, Color& out);
 };
 
 }  // namespace HyprZones
@@ -2,7 +2,10 @@
 
 #include "Layout.hpp"
 #include "Color.hpp"
+#include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 #include <unordered_map>
 
@@ -15,6 +18,29 @@ struct LayoutMapping {
     std::string layout;       // Layout name to use
 };
 
+// Mapping compiled at config load: monitor name and workspace ranges parsed once
+struct CompiledMapping {
+    std::string                      monitor;      // empty = any monitor
+    std::vector<std::pair<int, int>> workspaces;   // sorted inclusive ranges, empty = any workspace
+    size_t                           layoutIdx = 0;
+    long long                        workspaceCount = 0;  // covered workspaces (specificity)
+    size_t                           order     = 0;  // position in the config file
+
+    bool matches(const std::string& monitorName, int workspace) const;
+};
+
+// Reserved edges for a monitor, replacing what the compositor reports
+// (bars, layer surfaces, outer gaps). Negative = keep the reported edge.
+struct MonitorOverride {
+    std::string monitor;              // Monitor name (e.g. "DP-1") or "*" for all
+    int         reservedTop    = -1;
+    int         reservedBottom = -1;
+    int         reservedLeft   = -1;
+    int         reservedRight  = -1;
+
+    bool operator==(const MonitorOverride&) const = default;
+};
+
 struct Config {
     // Activation
     std::string snapModifier    = "SHIFT";
@@ -23,6 +49,7 @@ struct Config {
 
     // Visual
     bool  showZoneNumbers = true;
+    bool  showZoneNames   = true;
     Color highlightColor  = {0.0f, 0.4f, 1.0f, 0.3f};
     Color borderColor     = {0.0f, 0.4f, 1.0f, 0.8f};
     Color inactiveColor   = {0.4f, 0.4f, 0.4f, 0.2f};
@@ -39,14 +66,76 @@ struct Config {
     // Layouts
     std::vector<Layout>                     layouts;
     std::unordered_map<std::string, size_t> layoutIndex;  // name -> index in layouts
-    std::string                             activeLayout;
+    std::string                             activeLayout;  // default; switching lives in LayoutManager
 
     // Mappings: monitor/workspace -> layout
     std::vector<LayoutMapping> mappings;
+
+    // Mappings ranked most specific first (built by LayoutManager::compileMappings)
+    std::vector<CompiledMapping> compiledMappings;
+
+    // Identifies compiledMappings plus the layout order: fresh whenever they
+    // are rebuilt, carried over by diffConfig when they are identical. Keys
+    // LayoutManager's lookup memo, so snapshots only share it when equal.
+    uint64_t mappingsGeneration = 0;
+
+    // Per-monitor reserved-edge overrides, in file order
+    std::vector<MonitorOverride> monitorOverrides;
+
+    // Content hash of the file this config was loaded from (0 = not from a file)
+    uint64_t sourceHash = 0;
+};
+
+// Problem found while parsing; the offending line or section is skipped
+struct ConfigError {
+    int         line = 0;  // 1-based, 0 = not tied to a line
+    std::string message;
+};
+
+struct ConfigParseResult {
+    Config                   config;  // layouts, mappings, monitors and [general] settings
+    std::vector<ConfigError> errors;
+};
+
+// Next value of the process-wide counter behind layout and mapping generations
+uint64_t nextConfigGeneration();
+
+// Give every layout a fresh generation (invalidates resolved-layout caches)
+void assignLayoutGenerations(std::vector<Layout>& layouts);
+
+// After layouts were replaced: fresh layout and mapping generations, rebuilt
+// layoutIndex and the first layout as active layout
+void prepareLayouts(Config& config);
+
+// Single-pass parse of hyprzones.toml. Never throws; bad values keep their
+// defaults and are reported in errors. Mappings are not compiled yet.
+ConfigParseResult parseConfig(std::string_view text);
+ConfigParseResult parseConfigFile(const std::string& path);
+
+// Inverse of parseConfig: [general], layouts, mappings and monitors as TOML text.
+// Numbers are written in shortest round-trip form (no precision loss).
+std::string serializeConfig(const Config& config);
+
+struct ReloadStatus {
+    bool   unchanged        = false;  // source hash matched the loaded config, nothing reloaded
+    bool   fromCache        = false;  // loaded from the binary snapshot instead of parsing
+    bool   placementChanged = false;  // layouts, mappings or monitors changed, windows need re-snapping
+    size_t errors           = 0;
 };
 
 std::string getConfigPath();
-Config      loadConfig(const std::string& path);
-void        reloadConfig();
+
+// Load and compile a config (binary cache or parse). Thread-safe: touches no
+// plugin state, so the config watcher runs it on its worker thread.
+Config loadConfig(const std::string& path, std::vector<ConfigError>* errors = nullptr,
+                  bool* fromCache = nullptr);
+
+// Synchronous reload on the main thread (skipped if the file is unchanged)
+ReloadStatus reloadConfig(bool force = false);
+
+// Swap in a new snapshot (main thread, between events). Diffs it against
+// the current one first so unchanged layouts keep their caches; returns
+// true if window placement may have changed.
+bool publishConfig(std::shared_ptr<Config> config);
 
 }  // namespace HyprZones
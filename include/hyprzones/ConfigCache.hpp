@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Config.hpp"
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <string_view>
+
+namespace HyprZones {
+
+// Identity of the config file a cache entry was built from
+struct ConfigSource {
+    std::string path;
+    uint64_t    size  = 0;
+    timespec    mtime = {};
+};
+
+// 64-bit content hash of the config text (stored in Config::sourceHash), never 0
+uint64_t hashConfigText(std::string_view text);
+
+// $XDG_CACHE_HOME/hyprzones/config.bin (falls back to ~/.cache)
+std::string getConfigCachePath();
+
+// Load a compiled config snapshot written by saveConfigCache.
+// The snapshot is trusted when size and mtime match the source; otherwise
+// sourceText is hashed and must match the stored hash. Fills layouts, zones,
+// mappings, compiled mappings and general settings, then prepareLayouts().
+// Returns false (out untouched) if the cache is missing, stale or corrupt.
+bool loadConfigCache(const std::string& cachePath, const ConfigSource& source,
+                     std::string_view sourceText, Config& out);
+
+// Write a snapshot of config (mappings must already be compiled).
+// Written to a temporary file and renamed, so readers never see half a cache.
+bool saveConfigCache(const std::string& cachePath, const ConfigSource& source, const Config& config);
+
+}  // namespace HyprZones
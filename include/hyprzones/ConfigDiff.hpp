@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Config.hpp"
+#include <string>
+#include <vector>
+
+namespace HyprZones {
+
+// Zone index translation for a layout whose zones changed
+struct ZoneRemap {
+    std::string      layout;
+    std::vector<int> oldToNew;  // old zone index -> new index, -1 = zone gone
+};
+
+// What a reload changed, relative to the previously published config
+struct ConfigDiff {
+    size_t unchanged = 0;
+    size_t changed   = 0;
+    size_t added     = 0;
+    size_t removed   = 0;
+
+    std::vector<ZoneRemap> remaps;  // changed layouts whose zone indices moved
+
+    // Mapping lookups (compiled mappings or layout order) differ
+    bool mappingsChanged = false;
+
+    // [[monitors]] overrides differ (usable areas must be re-derived)
+    bool monitorsChanged = false;
+
+    // Windows may need new geometry
+    bool affectsPlacement() const { return changed > 0 || removed > 0 || mappingsChanged || monitorsChanged; }
+};
+
+// Compare layouts by name and zone content. Unchanged layouts in newConfig
+// take over their old generation, so resolved-layout and renderer caches
+// keyed by generation stay valid. Zones of changed layouts are matched by
+// name (the k-th zone of a name maps to the k-th zone of that name).
+ConfigDiff diffConfig(const Config& oldConfig, Config& newConfig);
+
+}  // namespace HyprZones
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Config.hpp"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace HyprZones {
+
+struct SaveResult {
+    std::string path;
+    bool        ok    = false;
+    size_t      bytes = 0;
+    std::string error;
+};
+
+// Background layout saving: the main thread hands over a config snapshot,
+// a worker serializes it and writes it atomically (temp file, fsync,
+// rename). Finished saves are reported through readyFd(), an eventfd the
+// plugin adds to the compositor's event loop, like ConfigWatcher.
+class ConfigSaver {
+  public:
+    ConfigSaver() = default;
+    ~ConfigSaver() { stop(); }
+
+    ConfigSaver(const ConfigSaver&)            = delete;
+    ConfigSaver& operator=(const ConfigSaver&) = delete;
+
+    bool start();
+    // Finishes queued saves, then joins the worker
+    void stop();
+
+    // Queue a save; the snapshot is immutable, so no copy is made
+    bool save(std::string path, std::shared_ptr<const Config> config);
+
+    // Readable while finished saves are waiting to be taken
+    int readyFd() const { return m_readyFd; }
+
+    // Main thread: take finished saves and clear readyFd
+    std::vector<SaveResult> takeResults();
+
+  private:
+    struct Job {
+        std::string                   path;
+        std::shared_ptr<const Config> config;
+    };
+
+    int         m_readyFd = -1;
+    std::thread m_worker;
+
+    std::mutex              m_mutex;
+    std::condition_variable m_wake;
+    std::deque<Job>         m_jobs;
+    std::vector<SaveResult> m_results;
+    bool                    m_stopping = false;
+
+    void run();
+};
+
+}  // namespace HyprZones
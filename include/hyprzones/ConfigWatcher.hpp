@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Config.hpp"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace HyprZones {
+
+// Hot reload: watches the config file's directory with inotify (editors
+// replace files by rename, so the file itself can't be watched) and loads
+// changed configs on a worker thread. A finished snapshot is handed to the
+// main thread through readyFd(), an eventfd the plugin adds to the
+// compositor's event loop; the swap itself happens there via publishConfig.
+class ConfigWatcher {
+  public:
+    ConfigWatcher() = default;
+    ~ConfigWatcher() { stop(); }
+
+    ConfigWatcher(const ConfigWatcher&)            = delete;
+    ConfigWatcher& operator=(const ConfigWatcher&) = delete;
+
+    // Start watching; returns false if inotify or the worker can't be set up
+    bool start(const std::string& configPath);
+    void stop();
+
+    // Readable while a loaded snapshot is waiting to be taken
+    int readyFd() const { return m_readyFd; }
+
+    // Main thread: take the waiting snapshot (nullptr if none) and clear readyFd
+    std::shared_ptr<Config> takeReady(ReloadStatus* status = nullptr);
+
+    // Hash of the published config; the worker skips files that still match
+    void setKnownHash(uint64_t hash) { m_knownHash.store(hash, std::memory_order_relaxed); }
+
+  private:
+    std::string m_path;
+    std::string m_fileName;
+    int         m_inotifyFd = -1;
+    int         m_stopFd    = -1;
+    int         m_readyFd   = -1;
+    std::thread m_worker;
+
+    std::atomic<uint64_t> m_knownHash{0};
+
+    std::mutex              m_pendingMutex;
+    std::shared_ptr<Config> m_pending;  // private to the watcher until taken
+    ReloadStatus            m_pendingStatus;
+
+    void run();
+    void reload();
+};
+
+}  // namespace HyprZones
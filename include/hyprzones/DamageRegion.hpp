@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ResolvedLayout.hpp"
+#include "WindowGeometryBackend.hpp"
+#include "ZoneSelection.hpp"
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace HyprZones {
+
+// Boxes (global layout coordinates) the compositor has to redraw. Holds up
+// to MAX_BOXES boxes without allocating; past that they collapse into their
+// bounding box. Boxes may overlap.
+class DamageRegion {
+  public:
+    static constexpr size_t MAX_BOXES = 8;
+
+    // Empty boxes are ignored; boxes covered by another one are dropped
+    void add(const GeometryBox& box);
+    void clear() { m_count = 0; }
+
+    bool                         empty() const { return m_count == 0; }
+    std::span<const GeometryBox> boxes() const { return {m_boxes.data(), m_count}; }
+
+    GeometryBox bounds() const;
+    bool        contains(double x, double y) const;
+    double      area() const;  // sum over boxes; counts overlaps twice
+
+  private:
+    std::array<GeometryBox, MAX_BOXES> m_boxes{};
+    size_t                             m_count = 0;
+};
+
+// Highlight change on a monitor: every zone highlighted before or after,
+// grown by the border width (plus a pixel for antialiasing) and clipped to
+// the monitor
+void addHighlightDamage(DamageRegion& out, const ResolvedLayout& resolved, const ZoneSelection& before,
+                        const ZoneSelection& after, int borderWidth);
+
+}  // namespace HyprZones
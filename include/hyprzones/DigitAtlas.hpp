@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace HyprZones {
+
+// Zone number badges are composed from one pre-rendered atlas per monitor
+// scale: cell 0 holds the circle background, cells 1-10 the digits 0-9.
+// Only the rasterization lives in the Renderer; cell layout, composition
+// and caching are here so they can be measured without a compositor.
+
+struct AtlasRect {
+    double x = 0;
+    double y = 0;
+    double w = 0;
+    double h = 0;
+};
+
+// Atlas cell sizes in texture pixels (already multiplied by the scale)
+struct DigitAtlasMetrics {
+    int fontSize   = 0;
+    int padding    = 0;
+    int badgeSize  = 0;  // circle cell, square
+    int digitWidth = 0;  // widest digit advance (measured when rasterizing); every digit cell has this width
+    int height     = 0;  // cell height (= badgeSize)
+
+    int       width() const { return badgeSize + 10 * digitWidth; }
+    AtlasRect badge() const { return {0, 0, double(badgeSize), double(height)}; }
+    AtlasRect digit(int d) const { return {double(badgeSize + d * digitWidth), 0, double(digitWidth), double(height)}; }
+
+    // Metrics for a monitor scale: 24 px digits with 8 px padding at 1x;
+    // digitWidth is left for the rasterizer to fill in
+    static DigitAtlasMetrics forScale(float scale);
+
+    bool operator==(const DigitAtlasMetrics&) const = default;
+};
+
+// One textured quad: atlas source rect, destination rect in monitor pixels
+struct AtlasQuad {
+    AtlasRect src;
+    AtlasRect dst;
+};
+
+inline constexpr int MAX_BADGE_DIGITS = 10;  // any int
+
+using BadgeQuads = std::array<AtlasQuad, 1 + MAX_BADGE_DIGITS>;
+
+// Badge for a non-negative number centred on (cx, cy): background quad,
+// then one quad per digit. Digits that don't fit inside the circle are
+// narrowed uniformly. Returns the number of quads written.
+size_t composeBadge(const DigitAtlasMetrics& metrics, int number, double cx, double cy, BadgeQuads& out);
+
+// Integer cache key for a monitor scale (hundredths)
+inline int atlasScaleKey(float scale) {
+    return static_cast<int>(scale * 100.0f + 0.5f);
+}
+
+// Atlases by scale key, least recently used evicted beyond capacity.
+// Linear scan: there are only ever a handful of monitor scales.
+template <typename Atlas>
+class DigitAtlasCache {
+  public:
+    explicit DigitAtlasCache(size_t capacity = 4) : m_capacity(capacity) {}
+
+    // Cached atlas for the key (marked most recently used), nullptr if none
+    Atlas* find(int key) {
+        for (auto& entry : m_entries) {
+            if (entry.key == key) {
+                entry.lastUse = ++m_clock;
+                return &entry.atlas;
+            }
+        }
+        return nullptr;
+    }
+
+    // Insert or replace; evicts the least recently used entry when full
+    Atlas& insert(int key, Atlas atlas) {
+        if (Atlas* existing = find(key)) {
+            *existing = std::move(atlas);
+            return *existing;
+        }
+        if (m_entries.size() >= m_capacity && !m_entries.empty()) {
+            size_t oldest = 0;
+            for (size_t i = 1; i < m_entries.size(); ++i) {
+                if (m_entries[i].lastUse < m_entries[oldest].lastUse)
+                    oldest = i;
+            }
+            m_entries.erase(m_entries.begin() + oldest);
+        }
+        m_entries.push_back({key, ++m_clock, std::move(atlas)});
+        return m_entries.back().atlas;
+    }
+
+    size_t size() const { return m_entries.size(); }
+    void   clear() { m_entries.clear(); }
+
+  private:
+    struct Entry {
+        int      key     = 0;
+        uint64_t lastUse = 0;
+        Atlas    atlas;
+    };
+
+    std::vector<Entry> m_entries;
+    size_t             m_capacity;
+    uint64_t           m_clock = 0;
+};
+
+}  // namespace HyprZones
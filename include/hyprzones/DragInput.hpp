@@ -0,0 +1,91 @@
+#pragma once
+
+#include "DamageRegion.hpp"
+#include "DragSession.hpp"
+#include "ResolvedLayout.hpp"
+#include "WindowGeometryBackend.hpp"
+#include "ZoneSelection.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace HyprZones {
+
+struct Config;
+class ZoneManager;
+class TraceRecorder;
+
+// Keyboard modifier bits as reported by the compositor (same values as
+// Hyprland's HL_MODIFIER_*)
+enum ModifierMask : uint32_t {
+    MOD_SHIFT = 1 << 0,
+    MOD_CTRL  = 1 << 2,
+    MOD_ALT   = 1 << 3,
+    MOD_META  = 1 << 6,
+};
+
+// Modifier mask for a snap modifier name ("SHIFT", "CTRL", ...); 0 if unknown
+uint32_t modifierMaskFromName(const std::string& name);
+
+// Compositor side of a drag: monitor lookup, layout resolution, overlay and
+// window placement. The plugin implements it on top of Hyprland; the trace
+// replay tool answers from a recorded trace.
+class DragHost {
+  public:
+    virtual ~DragHost() = default;
+
+    // Monitor under a point (identity only), nullptr if none
+    virtual void* monitorAt(double x, double y) = 0;
+
+    // Pixel layout of the monitor's active workspace under config
+    virtual std::shared_ptr<const ResolvedLayout> resolveLayout(void* monitor, const Config& config) = 0;
+
+    // Redraw the whole monitor, or only the given boxes of it
+    virtual void damage(void* monitor)                                   = 0;
+    virtual void damageRegion(void* monitor, const DamageRegion& region) = 0;
+
+    virtual void showOverlay() = 0;
+    virtual void hideOverlay() = 0;  // unless the user opened it manually
+
+    // Drop: place window on the selected zones of layoutName
+    virtual void snapWindow(void* window, const std::string& layoutName, const ZoneSelection& zones,
+                            const GeometryBox& box) = 0;
+
+    // Drag ended without a snap: the user placed window by hand
+    virtual void releaseWindow(void* window) = 0;
+};
+
+// Drag and zone-selection logic behind onMouseMove/onMouseButton, kept free
+// of compositor types so recorded traces replay through exactly this code.
+class DragInput {
+  public:
+    DragInput(DragSession& session, ZoneManager& zoneManager, DragHost& host)
+        : m_session(session), m_zoneManager(zoneManager), m_host(host) {}
+
+    // Pointer moved. draggedWindow is the window the compositor is moving
+    // (nullptr if none); config is the published snapshot, pinned when a
+    // drag starts.
+    void motion(double x, double y, uint32_t mods, void* draggedWindow, const std::shared_ptr<const Config>& config);
+
+    // Pointer button (Linux input code); releasing the left button drops
+    void button(uint32_t button, bool pressed);
+
+    // End the drag without snapping (dragged window closed)
+    void cancel();
+
+    // Record every event into recorder (nullptr stops recording)
+    void setRecorder(TraceRecorder* recorder) { m_recorder = recorder; }
+
+  private:
+    DragSession&   m_session;
+    ZoneManager&   m_zoneManager;
+    DragHost&      m_host;
+    TraceRecorder* m_recorder = nullptr;
+    DamageRegion   m_damage;
+
+    void bindMonitor(void* monitor);
+    bool drop();
+    void end();
+};
+
+}  // namespace HyprZones
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "ResolvedLayout.hpp"
+#include "ZoneSelection.hpp"
+#include <cstdint>
+#include <memory>
+
+namespace HyprZones {
+
+struct Config;
+class ZoneManager;
+
+// State of one window drag. Monitor, pixel layout and the snap modifier
+// mask are resolved once when the drag starts; the layout is re-resolved
+// only when the cursor crosses onto another monitor.
+struct DragSession {
+    bool   isDragging     = false;
+    bool   isZoneSnapping = false;
+    bool   ctrlHeld       = false;
+
+    void*  draggedWindow  = nullptr;  // PHLWINDOW
+    void*  currentMonitor = nullptr;  // CMonitor* (identity only, never dereferenced)
+
+    uint32_t snapModifierMask = 0;  // HL_MODIFIER_* bits of the configured snap modifier
+
+    // Config snapshot pinned for the whole drag; a reload published mid-drag
+    // takes effect with the next drag
+    std::shared_ptr<const Config> config;
+
+    std::shared_ptr<const ResolvedLayout> layout;  // pixel rects of currentMonitor
+
+    double dragStartX = 0;
+    double dragStartY = 0;
+    double currentX   = 0;
+    double currentY   = 0;
+
+    int           startZone   = -1;
+    int           currentZone = -1;
+    ZoneSelection selectedZones;
+
+    // True if the point lies on the monitor the session resolved
+    bool onCurrentMonitor(double px, double py) const {
+        if (!layout)
+            return false;
+        const auto& m = layout->key.monitor;
+        return px >= m.x && px < m.x + m.width && py >= m.y && py < m.y + m.height;
+    }
+
+    // Switch to another monitor's layout; zone selection restarts there
+    void setMonitor(void* monitor, std::shared_ptr<const ResolvedLayout> resolved);
+
+    // Zone under the cursor after hysteresis and gap fallback
+    int zoneAt(ZoneManager& zoneManager, double px, double py) const;
+
+    // Leave zone snapping but keep the drag (modifier released)
+    void stopSnapping();
+
+    // Update cursor and zone selection; returns true if the selection changed.
+    // With the pinned config's sensitivity radius, the current zone is kept
+    // until the cursor is that far past its edge, and in gaps the nearest
+    // zone within the radius is picked.
+    bool updateCursor(ZoneManager& zoneManager, double px, double py);
+
+    void reset() {
+        isDragging       = false;
+        isZoneSnapping   = false;
+        ctrlHeld         = false;
+        draggedWindow    = nullptr;
+        currentMonitor   = nullptr;
+        snapModifierMask = 0;
+        config.reset();
+        layout.reset();
+        dragStartX       = 0;
+        dragStartY       = 0;
+        currentX         = 0;
+        currentY         = 0;
+        startZone        = -1;
+        currentZone      = -1;
+        selectedZones.clear();
+    }
+};
+
+}  // namespace HyprZones
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace HyprZones {
+
+// Open-addressing hash map keyed by raw pointers (linear probing,
+// backward-shift deletion, load factor <= 1/2). nullptr is the empty-slot
+// marker and cannot be used as a key. Value pointers returned by find()
+// stay valid until the next insertion.
+template <typename V>
+class FlatPtrMap {
+  public:
+    V* find(const void* key) {
+        if (!key || m_slots.empty())
+            return nullptr;
+        for (size_t i = home(key);; i = (i + 1) & mask()) {
+            if (m_slots[i].key == key)
+                return &m_slots[i].value;
+            if (!m_slots[i].key)
+                return nullptr;
+        }
+    }
+
+    const V* find(const void* key) const {
+        return const_cast<FlatPtrMap*>(this)->find(key);
+    }
+
+    bool contains(const void* key) const { return find(key) != nullptr; }
+
+    // Insert a default value if the key is missing
+    V& operator[](void* key) {
+        if ((m_size + 1) * 2 > m_slots.size())
+            grow();
+        size_t i = home(key);
+        while (m_slots[i].key && m_slots[i].key != key) {
+            i = (i + 1) & mask();
+        }
+        if (!m_slots[i].key) {
+            m_slots[i].key = key;
+            ++m_size;
+        }
+        return m_slots[i].value;
+    }
+
+    bool erase(const void* key) {
+        if (!key || m_slots.empty())
+            return false;
+
+        size_t i = home(key);
+        while (m_slots[i].key != key) {
+            if (!m_slots[i].key)
+                return false;
+            i = (i + 1) & mask();
+        }
+
+        // Backward-shift following entries so probe chains stay intact
+        for (size_t j = (i + 1) & mask(); m_slots[j].key; j = (j + 1) & mask()) {
+            size_t k = home(m_slots[j].key);
+            bool   movable = (j > i) ? (k <= i || k > j) : (k <= i && k > j);
+            if (movable) {
+                m_slots[i] = std::move(m_slots[j]);
+                i          = j;
+            }
+        }
+        m_slots[i] = Slot{};
+        --m_size;
+        return true;
+    }
+
+    // Remove every entry for which pred(key, value) returns true
+    template <typename Pred>
+    size_t eraseIf(Pred&& pred) {
+        std::vector<void*> doomed;
+        forEach([&](void* key, V& value) {
+            if (pred(key, value))
+                doomed.push_back(key);
+        });
+        for (void* key : doomed) {
+            erase(key);
+        }
+        return doomed.size();
+    }
+
+    // Call fn(key, value) for every entry (must not insert or erase)
+    template <typename Fn>
+    void forEach(Fn&& fn) {
+        for (auto& slot : m_slots) {
+            if (slot.key)
+                fn(slot.key, slot.value);
+        }
+    }
+
+    size_t size() const { return m_size; }
+    bool   empty() const { return m_size == 0; }
+
+    void clear() {
+        m_slots.clear();
+        m_size = 0;
+    }
+
+  private:
+    struct Slot {
+        void* key = nullptr;
+        V     value{};
+    };
+
+    std::vector<Slot> m_slots;
+    size_t            m_size = 0;
+
+    size_t mask() const { return m_slots.size() - 1; }
+
+    // Fibonacci hashing of the pointer (low bits are alignment zeros)
+    size_t home(const void* key) const {
+        auto h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(h >> 32) & mask();
+    }
+
+    void grow() {
+        std::vector<Slot> old = std::move(m_slots);
+        m_slots.clear();
+        m_slots.resize(old.empty() ? 16 : old.size() * 2);
+        m_size = 0;
+        for (auto& slot : old) {
+            if (slot.key)
+                (*this)[slot.key] = std::move(slot.value);
+        }
+    }
+};
+
+}  // namespace HyprZones
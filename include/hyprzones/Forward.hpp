@@ -7,12 +7,17 @@ namespace HyprZones {
 struct Zone;
 struct Layout;
 struct Config;
-struct DragState;
+struct DragSession;
 struct WindowZoneAssignment;
 
 class ZoneManager;
 class LayoutManager;
+class MonitorTracker;
 class WindowSnapper;
+class WindowRegistry;
+class WindowGeometryBackend;
+class ConfigWatcher;
+class ConfigSaver;
 class Renderer;
 
 }  // namespace HyprZones
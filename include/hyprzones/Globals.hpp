@@ -12,12 +12,17 @@ namespace HyprZones {
 extern HANDLE g_handle;
 
 // Global instances
-extern std::unique_ptr<ZoneManager>   g_zoneManager;
-extern std::unique_ptr<LayoutManager> g_layoutManager;
-extern std::unique_ptr<WindowSnapper> g_windowSnapper;
-extern std::unique_ptr<Renderer>      g_renderer;
-extern Config                         g_config;
-extern DragState                      g_dragState;
+extern std::unique_ptr<ZoneManager>           g_zoneManager;
+extern std::unique_ptr<LayoutManager>         g_layoutManager;
+extern std::unique_ptr<MonitorTracker>        g_monitorTracker;
+extern std::unique_ptr<WindowSnapper>         g_windowSnapper;
+extern std::unique_ptr<WindowRegistry>        g_windowRegistry;
+extern std::unique_ptr<WindowGeometryBackend> g_geometryBackend;
+extern std::unique_ptr<Renderer>              g_renderer;
+extern std::unique_ptr<ConfigWatcher>         g_configWatcher;
+extern std::unique_ptr<ConfigSaver>           g_configSaver;
+extern std::shared_ptr<const Config>          g_config;  // published snapshot, swapped by publishConfig
+extern DragSession                            g_dragSession;
 
 // Initialize all globals
 void initGlobals();
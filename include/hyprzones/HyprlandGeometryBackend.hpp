@@ -0,0 +1,17 @@
+#pragma once
+
+#include "WindowGeometryBackend.hpp"
+
+namespace HyprZones {
+
+// Places windows through Hyprland's resizewindowpixel/movewindowpixel
+// dispatchers, the path its own keybinds take, so the layout keeps the
+// window's floating geometry and damages the old and new boxes. The
+// "exact X Y,address:0x..." arguments go into stack buffers and the
+// dispatcher functions are called directly, not via a hyprctl round-trip.
+class HyprlandGeometryBackend : public WindowGeometryBackend {
+  public:
+    bool apply(void* window, const GeometryBox& box) override;
+};
+
+}  // namespace HyprZones
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace HyprZones {
+
+// What a rendered label depends on
+struct LabelKey {
+    std::string text;
+    int         scaleKey = 100;  // atlasScaleKey() of the monitor scale
+    uint32_t    color    = 0;    // RGBA8
+
+    bool operator==(const LabelKey&) const = default;
+};
+
+// Non-owning form for lookups, so cache hits don't copy the text
+struct LabelKeyView {
+    std::string_view text;
+    int              scaleKey = 100;
+    uint32_t         color    = 0;
+};
+
+struct LabelKeyHash {
+    using is_transparent = void;
+    size_t operator()(const LabelKeyView& key) const;
+    size_t operator()(const LabelKey& key) const { return (*this)(LabelKeyView{key.text, key.scaleKey, key.color}); }
+};
+
+struct LabelKeyEqual {
+    using is_transparent = void;
+    static LabelKeyView view(const LabelKey& key) { return {key.text, key.scaleKey, key.color}; }
+    static LabelKeyView view(const LabelKeyView& key) { return key; }
+    bool operator()(const auto& a, const auto& b) const {
+        LabelKeyView x = view(a), y = view(b);
+        return x.text == y.text && x.scaleKey == y.scaleKey && x.color == y.color;
+    }
+};
+
+// CPU pixels of one label: ARGB32, premultiplied, rows `stride` bytes apart
+struct LabelBitmap {
+    int                        width  = 0;
+    int                        height = 0;
+    int                        stride = 0;
+    std::vector<unsigned char> pixels;
+};
+
+// Shapes and rasterizes one label; runs on the worker thread
+using LabelRasterizer = std::function<LabelBitmap(const LabelKey&)>;
+
+// Label rasterization off the main thread: keys are queued, a worker
+// rasterizes them into CPU bitmaps, and finished ones are reported through
+// readyFd(), an eventfd in the compositor's event loop (like ConfigSaver).
+class LabelWorker {
+  public:
+    static constexpr size_t MAX_QUEUED = 64;
+
+    explicit LabelWorker(LabelRasterizer rasterizer) : m_rasterizer(std::move(rasterizer)) {}
+    ~LabelWorker() { stop(); }
+
+    LabelWorker(const LabelWorker&)            = delete;
+    LabelWorker& operator=(const LabelWorker&) = delete;
+
+    bool start();
+    // Drops queued requests and joins the worker
+    void stop();
+
+    // False if the worker isn't running or MAX_QUEUED requests are waiting
+    bool request(LabelKey key);
+
+    int readyFd() const { return m_readyFd; }
+
+    // Main thread: take finished bitmaps and clear readyFd
+    std::vector<std::pair<LabelKey, LabelBitmap>> takeResults();
+
+  private:
+    LabelRasterizer m_rasterizer;
+    int             m_readyFd = -1;
+    std::thread     m_worker;
+
+    std::mutex                                    m_mutex;
+    std::condition_variable                       m_wake;
+    std::deque<LabelKey>                          m_queue;
+    std::vector<std::pair<LabelKey, LabelBitmap>> m_results;
+    bool                                          m_stopping = false;
+
+    void run();
+};
+
+// Uploaded labels by text, scale and colour. find() never rasterizes: a
+// missing label is requested from the worker and drawn once upload() has
+// turned its bitmap into a Texture on the main thread. Uploaded textures
+// are bounded by budgetBytes (least recently used evicted first).
+template <typename Texture>
+class LabelCache {
+  public:
+    static constexpr size_t DEFAULT_BUDGET = 16 * 1024 * 1024;
+
+    explicit LabelCache(LabelRasterizer rasterizer, size_t budgetBytes = DEFAULT_BUDGET)
+        : m_worker(std::move(rasterizer)), m_budget(budgetBytes) {}
+
+    bool start() { return m_worker.start(); }
+    void stop() { m_worker.stop(); }
+    int  readyFd() const { return m_worker.readyFd(); }
+
+    // Uploaded texture, or nullptr while the label is (being) rasterized
+    const Texture* find(const LabelKeyView& key) {
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            LabelKey owned{std::string(key.text), key.scaleKey, key.color};
+            if (m_worker.request(owned))
+                m_entries.emplace(std::move(owned), Entry{});
+            return nullptr;  // queue full: asked again next frame
+        }
+        if (!it->second.ready)
+            return nullptr;
+        it->second.lastUse = ++m_clock;
+        return &it->second.texture;
+    }
+
+    // Main thread: turn finished bitmaps into textures with make(bitmap)
+    // and enforce the budget. Returns the number of labels uploaded.
+    template <typename Make>
+    size_t upload(Make&& make) {
+        size_t uploaded = 0;
+        for (auto& [key, bitmap] : m_worker.takeResults()) {
+            auto it = m_entries.find(key);
+            if (it == m_entries.end() || it->second.ready)
+                continue;  // cleared meanwhile, or a duplicate request
+            it->second.ready   = true;
+            it->second.texture = make(bitmap);
+            it->second.bytes   = static_cast<size_t>(bitmap.stride) * bitmap.height;
+            it->second.lastUse = ++m_clock;
+            m_bytes += it->second.bytes;
+            ++uploaded;
+        }
+        evictOverBudget();
+        return uploaded;
+    }
+
+    // Forget everything; results still in flight are discarded on upload
+    void clear() {
+        m_entries.clear();
+        m_bytes = 0;
+    }
+
+    size_t size() const { return m_entries.size(); }
+    size_t bytes() const { return m_bytes; }
+
+  private:
+    struct Entry {
+        bool     ready = false;
+        Texture  texture{};
+        size_t   bytes   = 0;
+        uint64_t lastUse = 0;
+    };
+
+    LabelWorker                                                      m_worker;
+    std::unordered_map<LabelKey, Entry, LabelKeyHash, LabelKeyEqual> m_entries;
+    size_t                                                           m_budget;
+    size_t                                                           m_bytes = 0;
+    uint64_t                                                         m_clock = 0;
+
+    void evictOverBudget() {
+        while (m_bytes > m_budget) {
+            auto oldest = m_entries.end();
+            for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+                if (it->second.ready && (oldest == m_entries.end() || it->second.lastUse < oldest->second.lastUse))
+                    oldest = it;
+            }
+            if (oldest == m_entries.end())
+                return;
+            m_bytes -= oldest->second.bytes;
+            m_entries.erase(oldest);
+        }
+    }
+};
+
+}  // namespace HyprZones
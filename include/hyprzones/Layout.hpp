@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Zone.hpp"
+#include "ZoneIndex.hpp"
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -9,6 +11,7 @@ namespace HyprZones {
 struct Layout {
     std::string       name;
     std::string       hotkey;     // e.g., "SUPER+CTRL+1"
+    uint64_t          generation = 0;  // Unique per loaded layout, keys resolved-layout caches
     int               spacingH = 40;  // Horizontal gap between zones in pixels
     int               spacingV = 10;  // Vertical gap between zones in pixels
     std::vector<Zone> zones;
@@ -19,6 +22,9 @@ struct Layout {
     int                 rows    = 0;
     std::vector<double> columnPercents;
     std::vector<double> rowPercents;
+
+    // Hit-test grid over zone pixels (rebuilt by computeZonePixels)
+    ZoneIndex spatialIndex;
 };
 
 }  // namespace HyprZones
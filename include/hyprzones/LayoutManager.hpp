@@ -3,6 +3,8 @@
 #include "Layout.hpp"
 #include "Config.hpp"
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace HyprZones {
@@ -14,24 +16,40 @@ class LayoutManager {
                                 int cols, int rows,
                                 const std::string& name = "");
 
-    // Get layout for current context
-    Layout* getLayoutForMonitor(Config& config,
-                                const std::string& monitorName,
-                                int workspace);
+    // Compile config.mappings into ranked range sets (call after load).
+    // Touches no manager state, so config loading can run off the main thread.
+    static void compileMappings(Config& config);
 
-    // Layout switching
-    void switchLayout(Config& config, const std::string& layoutName);
-    void cycleLayout(Config& config, int direction);
+    // Get layout for current context (memoized per monitor/workspace)
+    const Layout* getLayoutForMonitor(const Config& config,
+                                      const std::string& monitorName,
+                                      int workspace);
 
-    // Persistence
-    bool saveLayouts(const std::string& path, const std::vector<Layout>& layouts,
-                     const std::vector<LayoutMapping>& mappings);
-    std::vector<Layout> loadLayouts(const std::string& path);
-    std::vector<LayoutMapping> loadMappings(const std::string& path);
+    // Forget memoized lookups. Snapshots with other mappings never see
+    // them anyway: the memo is keyed on Config::mappingsGeneration.
+    void invalidateMappingCache();
+
+    // Layout switching (runtime state, survives config snapshot swaps while
+    // the layout still exists; empty = config.activeLayout)
+    void switchLayout(const Config& config, const std::string& layoutName);
+    void cycleLayout(const Config& config, int direction);
+    const std::string& activeLayout(const Config& config) const;
+
+    // Per-monitor switch: the monitor shows this layout instead of what its
+    // mappings pick, for as long as the layout exists. False if unknown.
+    bool switchMonitorLayout(const Config& config, const std::string& monitorName, const std::string& layoutName);
 
   private:
-    // Check if workspace matches a workspace pattern (e.g. "1-5", "1,3,5", "*")
-    bool workspaceMatchesPattern(int workspace, const std::string& pattern);
+    // Parse a workspace pattern (e.g. "1-5", "1,3,5", "*") into sorted ranges
+    static bool parseWorkspacePattern(std::string_view pattern,
+                                      std::vector<std::pair<int, int>>& outRanges);
+
+    // monitor name -> workspace -> layout index (-1 = no mapping matched)
+    std::unordered_map<std::string, std::unordered_map<int, int>> m_mappingMemo;
+    uint64_t                                                      m_memoGeneration = 0;
+
+    std::string                                  m_activeLayout;
+    std::unordered_map<std::string, std::string> m_monitorLayouts;  // monitor name -> layout name
 };
 
 }  // namespace HyprZones
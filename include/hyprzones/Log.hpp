@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace HyprZones {
+
+enum class LogLevel : uint8_t {
+    Debug,
+    Info,
+    Warn,
+    Error,
+};
+
+// Process-wide logger. write() formats into a fixed slot of a lock-free ring
+// buffer (no allocation, no syscall) and returns; a background thread drains
+// the ring into the log file in batches. Messages longer than a slot are
+// truncated, and if the ring is full the message is dropped and counted.
+// Usable from any thread, before start() too (messages wait in the ring).
+namespace Log {
+
+inline constexpr const char* DEFAULT_PATH = "/tmp/hyprzones.log";
+
+// Open path for appending and start the flusher thread
+bool start(const std::string& path = DEFAULT_PATH);
+// Flush what is queued, then stop the flusher and close the file
+void stop();
+
+void     setLevel(LogLevel level);
+bool     enabled(LogLevel level);
+uint64_t droppedCount();
+
+void write(LogLevel level, const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+}  // namespace Log
+
+}  // namespace HyprZones
+
+// Arguments are only evaluated if the level is enabled. Debug messages are
+// compiled out of release (NDEBUG) builds entirely.
+#define HZ_LOG(level, ...)                                                                                             \
+    do {                                                                                                               \
+        if (::HyprZones::Log::enabled(level))                                                                          \
+            ::HyprZones::Log::write(level, __VA_ARGS__);                                                               \
+    } while (0)
+
+#ifdef NDEBUG
+#define HZ_LOG_DEBUG(...) ((void)0)
+#else
+#define HZ_LOG_DEBUG(...) HZ_LOG(::HyprZones::LogLevel::Debug, __VA_ARGS__)
+#endif
+#define HZ_LOG_INFO(...)  HZ_LOG(::HyprZones::LogLevel::Info, __VA_ARGS__)
+#define HZ_LOG_WARN(...)  HZ_LOG(::HyprZones::LogLevel::Warn, __VA_ARGS__)
+#define HZ_LOG_ERROR(...) HZ_LOG(::HyprZones::LogLevel::Error, __VA_ARGS__)
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <ctime>
+#include <string>
+#include <string_view>
+
+namespace HyprZones {
+
+// Read-only memory mapping of a whole file (RAII)
+class MappedFile {
+  public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path) { open(path); }
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Returns false if the file can't be opened or mapped
+    bool open(const std::string& path);
+    void close();
+
+    bool             isOpen() const { return m_open; }
+    std::string_view view() const { return {static_cast<const char*>(m_data), m_size}; }
+    size_t           size() const { return m_size; }
+    timespec         mtime() const { return m_mtime; }
+
+  private:
+    void*    m_data  = nullptr;
+    size_t   m_size  = 0;
+    timespec m_mtime = {};
+    bool     m_open  = false;
+};
+
+}  // namespace HyprZones
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Config.hpp"
+#include "ResolvedLayout.hpp"
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace HyprZones {
+
+// [[monitors]] entry for a monitor: exact name first, then "*"; null if none
+const MonitorOverride* findMonitorOverride(const Config& config, std::string_view monitorName);
+
+// Reported geometry with the override's edges swapped in. An override that
+// would leave no usable width (or height) is ignored on that axis.
+MonitorGeometry applyMonitorOverride(const MonitorGeometry& reported, const MonitorOverride* override);
+
+// Usable-area record per monitor, refreshed from monitor events instead of
+// being read from the compositor on every lookup. Keeps what the compositor
+// reported, so an override change is re-derived without asking it again.
+class MonitorTracker {
+  public:
+    // Record a monitor's reported geometry; true if its usable area changed
+    // (or the monitor is new)
+    bool update(const std::string& name, const MonitorGeometry& reported, const Config& config);
+
+    // Re-derive every monitor under new overrides; fills the monitors whose
+    // usable area changed
+    void reapply(const Config& config, std::vector<std::string>& changed);
+
+    // False if the monitor was not tracked
+    bool remove(const std::string& name);
+    void clear() { m_monitors.clear(); }
+
+    // Usable-area record, null for monitors never updated
+    const MonitorGeometry* find(const std::string& name) const;
+    size_t                 size() const { return m_monitors.size(); }
+
+  private:
+    struct Record {
+        MonitorGeometry reported;
+        MonitorGeometry effective;
+    };
+
+    std::unordered_map<std::string, Record> m_monitors;
+};
+
+}  // namespace HyprZones
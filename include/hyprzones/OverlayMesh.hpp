@@ -0,0 +1,123 @@
+#pragma once
+
+#include "Color.hpp"
+#include "DigitAtlas.hpp"
+#include "ResolvedLayout.hpp"
+#include "ZoneSelection.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace HyprZones {
+
+// One triangle vertex: monitor pixel position and premultiplied RGBA
+struct OverlayVertex {
+    float x, y;
+    float r, g, b, a;
+};
+
+// Everything besides the zones the overlay's look depends on
+struct OverlayStyle {
+    Color inactive;
+    Color highlight;
+    Color border;
+    float alpha       = 1.0f;
+    int   borderWidth = 0;  // logical pixels, drawn outside the zone
+
+    bool operator==(const OverlayStyle& o) const {
+        auto same = [](const Color& a, const Color& b) { return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a; };
+        return same(inactive, o.inactive) && same(highlight, o.highlight) && same(border, o.border) &&
+               alpha == o.alpha && borderWidth == o.borderWidth;
+    }
+};
+
+// Triangles for all zone fills and borders of one monitor's overlay, in
+// draw order (each zone's fill, then its border). Rebuilt only when the
+// resolved layout, monitor placement, highlight or style changed; the
+// vertex buffer keeps its capacity, so unchanged frames and same-sized
+// rebuilds don't allocate.
+class OverlayMesh {
+  public:
+    static constexpr size_t VERTICES_PER_ZONE = 6 * 5;  // fill quad + four border strips
+
+    // (originX, originY) is the monitor's top-left in layout coordinates.
+    // Returns true if the vertices were rebuilt.
+    bool update(const ResolvedLayout& resolved, double originX, double originY, double scale,
+                const ZoneSelection& highlighted, const OverlayStyle& style);
+
+    std::span<const OverlayVertex> vertices() const { return m_vertices; }
+    uint64_t                       version() const { return m_version; }  // bumped by every rebuild
+
+    // Force a rebuild on the next update()
+    void invalidate() { m_valid = false; }
+
+  private:
+    bool                       m_valid = false;
+    ResolvedLayoutKey          m_layoutKey;
+    size_t                     m_zoneCount = 0;
+    double                     m_originX   = 0;
+    double                     m_originY   = 0;
+    double                     m_scale     = 0;
+    ZoneSelection              m_highlighted;
+    OverlayStyle               m_style;
+    std::vector<OverlayVertex> m_vertices;
+    uint64_t                   m_version = 0;
+
+    void rebuild(const ResolvedLayout& resolved);
+};
+
+// One textured vertex: monitor pixel position and texture coordinates
+struct OverlayTexVertex {
+    float x, y;
+    float u, v;
+};
+
+// A zone name label ready to draw: its zone and texture size in pixels
+struct OverlayLabel {
+    int   zone   = -1;
+    float width  = 0;
+    float height = 0;
+
+    bool operator==(const OverlayLabel&) const = default;
+};
+
+// Textured quads for the zone numbers and names of one monitor's overlay.
+// Each badge's circle and digits are cells of the digit atlas, so all
+// badges are one draw from one texture; they come first, followed by one
+// quad per label (each label is its own texture). Rebuilt only when the
+// resolved layout, monitor placement, atlas or set of ready labels
+// changed; keeps its capacity like OverlayMesh.
+class OverlayTextMesh {
+  public:
+    static constexpr size_t VERTICES_PER_QUAD = 6;
+
+    // badges.badgeSize == 0 draws no numbers; labels sit below the badge,
+    // or centred in their zone without one. Returns true if rebuilt.
+    bool update(const ResolvedLayout& resolved, double originX, double originY, double scale,
+                const DigitAtlasMetrics& badges, std::span<const OverlayLabel> labels = {});
+
+    // Badges, then label i at badgeVertexCount() + i * VERTICES_PER_QUAD
+    std::span<const OverlayTexVertex> vertices() const { return m_vertices; }
+    size_t                            badgeVertexCount() const { return m_badgeVertices; }
+    uint64_t                          version() const { return m_version; }  // bumped by every rebuild
+
+    // Force a rebuild on the next update()
+    void invalidate() { m_valid = false; }
+
+  private:
+    bool                          m_valid = false;
+    ResolvedLayoutKey             m_layoutKey;
+    size_t                        m_zoneCount = 0;
+    double                        m_originX   = 0;
+    double                        m_originY   = 0;
+    double                        m_scale     = 0;
+    DigitAtlasMetrics             m_badges;
+    std::vector<OverlayLabel>     m_labels;
+    std::vector<OverlayTexVertex> m_vertices;
+    size_t                        m_badgeVertices = 0;
+    uint64_t                      m_version       = 0;
+
+    void rebuild(const ResolvedLayout& resolved);
+};
+
+}  // namespace HyprZones
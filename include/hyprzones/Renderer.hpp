@@ -2,10 +2,15 @@
 
 #include "Layout.hpp"
 #include "Config.hpp"
+#include "DigitAtlas.hpp"
+#include "LabelCache.hpp"
+#include "ResolvedLayout.hpp"
+#include "ZoneBatchPassElement.hpp"
+#include "ZoneSelection.hpp"
 #include <hyprland/src/render/Texture.hpp>
-#include <vector>
+#include <memory>
 #include <unordered_map>
-#include <string>
+#include <vector>
 
 namespace HyprZones {
 
@@ -14,10 +19,13 @@ class Renderer {
     Renderer();
     ~Renderer();
 
-    void renderOverlay(void* monitor, const Layout& layout,
-                       const std::vector<int>& highlightedZones,
+    void renderOverlay(void* monitor, const ResolvedLayout& resolved,
+                       const ZoneSelection& highlightedZones,
                        const Config& config);
 
+    // Monitor unplugged: free its overlay batch
+    void forgetMonitor(void* monitor);
+
     void show(bool manual = false);
     void hide();
     bool isVisible() const { return m_visible; }
@@ -26,20 +34,38 @@ class Renderer {
     void setAlpha(float a) { m_alpha = a; }
     float getAlpha() const { return m_alpha; }
 
+    // Drop the digit atlases and zone name labels (they otherwise persist across show/hide)
     void clearCache();
     void invalidateCache();
 
+    // Zone names are rasterized on a worker; labelReadyFd() becomes readable
+    // when some are done and uploadLabels() turns them into textures. Returns
+    // true if anything new can be drawn.
+    int  labelReadyFd() const { return m_labels.readyFd(); }
+    bool uploadLabels();
+
   private:
     bool  m_visible = false;
     bool  m_manuallyOpened = false;
     float m_alpha   = 0.8f;
     bool  m_needsRedraw = true;
-    std::string m_cachedLayoutName;
-    std::unordered_map<std::string, SP<CTexture>> m_cachedNumberTextures;
+    uint64_t m_cachedLayoutGeneration = 0;  // unchanged across reloads that keep the layout
+
+    struct NumberAtlas {
+        SP<CTexture>      texture;
+        DigitAtlasMetrics metrics;
+    };
+    DigitAtlasCache<NumberAtlas> m_numberAtlases;  // by atlasScaleKey()
+    LabelCache<SP<CTexture>>     m_labels;
+
+    // Zone fills, borders, badges and labels per monitor; boxed so pass elements can hold a reference
+    std::unordered_map<void*, std::unique_ptr<ZoneBatch>> m_batches;
+    std::vector<OverlayLabel>                             m_readyLabels;  // scratch, keeps its capacity
 
-    void drawZone(void* monitor, const Zone& zone, bool highlighted, const Config& config);
-    void drawCachedNumber(void* monitor, const Zone& zone, int number);
-    SP<CTexture> getOrCreateNumberTexture(int number, float scale);
+    // atlas == nullptr: no numbers
+    void drawZones(void* monitor, const ResolvedLayout& resolved, const ZoneSelection& highlightedZones,
+                   const Config& config, const NumberAtlas* atlas);
+    const NumberAtlas* getOrCreateNumberAtlas(float scale);
 };
 
 }  // namespace HyprZones
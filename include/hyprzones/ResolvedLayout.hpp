@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Layout.hpp"
+#include "ZoneGraph.hpp"
+#include <cstdint>
+
+namespace HyprZones {
+
+// Monitor geometry in logical (layout) coordinates
+struct MonitorGeometry {
+    double x      = 0;
+    double y      = 0;
+    double width  = 0;
+    double height = 0;
+    double scale  = 1.0;
+
+    // Edges reserved for bars and outer gaps, excluded from the zone area
+    double reservedTop    = 0;
+    double reservedBottom = 0;
+    double reservedLeft   = 0;
+    double reservedRight  = 0;
+
+    double usableX() const { return x + reservedLeft; }
+    double usableY() const { return y + reservedTop; }
+    double usableW() const { return width - reservedLeft - reservedRight; }
+    double usableH() const { return height - reservedTop - reservedBottom; }
+
+    bool operator==(const MonitorGeometry&) const = default;
+};
+
+// Everything the pixel rects of a layout depend on
+struct ResolvedLayoutKey {
+    uint64_t        layoutGeneration = 0;
+    MonitorGeometry monitor;
+
+    bool operator==(const ResolvedLayoutKey&) const = default;
+};
+
+// Immutable pixel resolution of one layout on one monitor.
+// Holds its own copy of the zones so monitors sharing a layout don't
+// overwrite each other's pixel rects.
+struct ResolvedLayout {
+    ResolvedLayoutKey key;
+    Layout            layout;  // zones with pixel rects and spatial index
+    ZoneGraph         graph;   // which zones touch, for spans and directional moves
+};
+
+}  // namespace HyprZones
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace HyprZones {
+
+// Latency histogram with log-linear buckets: exact below 8 ns, then four
+// buckets per power of two (percentiles are within 25%). Fixed size, no
+// allocation; record() is a few instructions.
+class LatencyHistogram {
+  public:
+    void record(uint64_t ns) {
+        ++m_buckets[bucketOf(ns)];
+        ++m_count;
+        m_sum += ns;
+        m_max = ns > m_max ? ns : m_max;
+    }
+    void reset() { *this = LatencyHistogram{}; }
+
+    uint64_t count() const { return m_count; }
+    uint64_t max() const { return m_max; }
+    double   mean() const { return m_count ? static_cast<double>(m_sum) / static_cast<double>(m_count) : 0.0; }
+
+    // Upper bound of the bucket holding the p-quantile (0..1), capped at max()
+    uint64_t percentile(double p) const;
+
+    static size_t   bucketOf(uint64_t ns);
+    static uint64_t bucketUpper(size_t bucket);
+
+  private:
+    static constexpr size_t BUCKETS = 252;  // covers the full uint64_t range
+
+    std::array<uint64_t, BUCKETS> m_buckets{};
+    uint64_t                      m_count = 0;
+    uint64_t                      m_sum   = 0;
+    uint64_t                      m_max   = 0;
+};
+
+// Timed entry points (callbacks and IPC handlers)
+enum class Probe : uint8_t {
+    MouseMove,
+    MouseButton,
+    Render,
+    CmdLayouts,
+    CmdMoveto,
+    CmdReload,
+    CmdSave,
+    CmdLoad,
+    CmdStats,
+    CmdTrace,
+    CmdBatch,
+    DispatchMoveto,
+    DispatchMovedir,
+    DispatchLayout,
+    DispatchCycle,
+    DispatchShow,
+    DispatchHide,
+    DispatchEditor,
+    Count,
+};
+
+enum class Counter : uint8_t {
+    DamageRequests,
+    DamagedPixels,
+    TexturesCreated,
+    TextureCacheHits,
+    ResolvedCacheHits,
+    ResolvedCacheMisses,
+    MappingCacheHits,
+    MappingCacheMisses,
+    UsableAreaChanges,
+    Count,
+};
+
+// Plugin-wide runtime statistics, reported by `hyprctl hyprzones:stats`.
+// Main thread only (every instrumented path runs there), so no atomics.
+class Stats {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    void record(Probe probe, uint64_t ns) { m_latency[static_cast<size_t>(probe)].record(ns); }
+    void count(Counter counter, uint64_t n = 1) { m_counters[static_cast<size_t>(counter)] += n; }
+
+    const LatencyHistogram& latency(Probe probe) const { return m_latency[static_cast<size_t>(probe)]; }
+    uint64_t                counter(Counter counter) const { return m_counters[static_cast<size_t>(counter)]; }
+    Clock::time_point       since() const { return m_since; }
+
+    void reset();
+
+    static const char* name(Probe probe);
+    static const char* name(Counter counter);
+
+  private:
+    std::array<LatencyHistogram, static_cast<size_t>(Probe::Count)> m_latency;
+    std::array<uint64_t, static_cast<size_t>(Counter::Count)>       m_counters{};
+    Clock::time_point                                               m_since = Clock::now();
+};
+
+extern Stats g_stats;
+
+// Times the enclosing scope into g_stats
+class ScopedProbe {
+  public:
+    explicit ScopedProbe(Probe probe) : m_probe(probe), m_start(Stats::Clock::now()) {}
+    ~ScopedProbe() {
+        auto elapsed = Stats::Clock::now() - m_start;
+        g_stats.record(m_probe, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    ScopedProbe(const ScopedProbe&)            = delete;
+    ScopedProbe& operator=(const ScopedProbe&) = delete;
+
+  private:
+    Probe                    m_probe;
+    Stats::Clock::time_point m_start;
+};
+
+// Values sampled at report time (e.g. window memory size)
+using StatsGauge = std::pair<const char*, uint64_t>;
+
+// Text table or JSON object; probes that never ran are omitted from the table
+std::string formatStats(const Stats& stats, bool json, std::span<const StatsGauge> gauges = {});
+
+}  // namespace HyprZones
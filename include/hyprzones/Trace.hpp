@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Layout.hpp"
+#include "ResolvedLayout.hpp"
+#include "WindowGeometryBackend.hpp"
+#include "ZoneSelection.hpp"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace HyprZones {
+
+struct Config;
+
+// Input traces (hyprctl hyprzones:trace): the events DragInput saw plus
+// what the compositor answered, so a drag can be replayed without Hyprland.
+//
+// File: "HZTRACE1", u32 version, then records of one type byte and a
+// packed payload in native byte order. State records (settings, monitor)
+// are written while the event that needed them is processed, i.e. right
+// after that event; replay applies them before dispatching it.
+inline constexpr char     TRACE_MAGIC[8] = {'H', 'Z', 'T', 'R', 'A', 'C', 'E', '1'};
+inline constexpr uint32_t TRACE_VERSION  = 3;
+
+enum class TraceRecordType : uint8_t {
+    Settings = 1,  // config fields the drag logic reads
+    Monitor  = 2,  // monitor bound by a drag: geometry and resolved layout
+    Motion   = 3,
+    Button   = 4,
+    Snap     = 5,  // drop decision
+};
+
+struct TraceMonitor {
+    uint32_t        id        = 0;
+    bool            hasLayout = false;
+    MonitorGeometry geometry;
+    Layout          layout;  // fractions; pixels are recomputed on replay
+};
+
+struct TraceSnap {
+    uint32_t         window = 0;
+    std::string      layout;
+    std::vector<int> zones;
+    GeometryBox      box;
+
+    bool operator==(const TraceSnap&) const = default;
+};
+
+struct TraceRecord {
+    TraceRecordType type    = TraceRecordType::Motion;
+    int64_t         timeNs  = 0;      // Motion, Button, Snap: since recording started
+    double          x       = 0;      // Motion
+    double          y       = 0;      // Motion
+    uint32_t        mods    = 0;      // Motion
+    uint32_t        window  = 0;      // Motion: dragged window id, 0 = none
+    uint32_t        button  = 0;      // Button: Linux input code
+    bool            pressed = false;  // Button
+    size_t          index   = 0;      // Settings: Trace::configs, Monitor: monitors, Snap: snaps
+};
+
+struct Trace {
+    std::vector<TraceRecord>                   records;
+    std::vector<std::shared_ptr<const Config>> configs;
+    std::vector<TraceMonitor>                  monitors;
+    std::vector<TraceSnap>                     snaps;
+};
+
+bool parseTrace(std::string_view data, Trace& out, std::string* error = nullptr);
+bool readTrace(const std::string& path, Trace& out, std::string* error = nullptr);
+
+// Writes a trace while recording. Records are buffered and written in
+// chunks; compositor pointers become small stable ids. Mouse motion
+// outside of drags is skipped except for the event that ends a drag.
+class TraceRecorder {
+  public:
+    ~TraceRecorder() { stop(); }
+
+    bool start(const std::string& path, std::string* error = nullptr);
+    // Write what is buffered and close; false if any write failed
+    bool stop(std::string* error = nullptr);
+
+    bool               active() const { return m_fd >= 0; }
+    const std::string& path() const { return m_path; }
+    size_t             eventCount() const { return m_events; }
+
+    void motion(double x, double y, uint32_t mods, void* window, const Config& config);
+    void button(uint32_t button, bool pressed);
+    void monitorBound(void* monitor, const ResolvedLayout* resolved);
+    void snapped(void* window, const std::string& layout, const ZoneSelection& zones, const GeometryBox& box);
+
+  private:
+    struct MonitorState {
+        uint64_t        generation = 0;
+        bool            hasLayout  = false;
+        MonitorGeometry geometry;
+    };
+
+    int                                        m_fd = -1;
+    std::string                                m_path;
+    std::string                                m_buffer;
+    bool                                       m_failed = false;
+    size_t                                     m_events = 0;
+    std::chrono::steady_clock::time_point      m_start;
+    std::unordered_map<void*, uint32_t>        m_windowIds;
+    std::unordered_map<void*, uint32_t>        m_monitorIds;
+    std::unordered_map<uint32_t, MonitorState> m_monitors;
+    bool                                       m_lastHadWindow = false;
+
+    // Last settings written
+    bool        m_haveSettings = false;
+    std::string m_snapModifier;
+    bool        m_showOnDrag      = false;
+    bool        m_requireModifier = false;
+    int         m_borderWidth     = 0;
+    int         m_sensitivity     = 0;
+
+    int64_t  now() const;
+    uint32_t idFor(std::unordered_map<void*, uint32_t>& ids, void* pointer);
+    void     flushIfLarge();
+    bool     flush();
+};
+
+}  // namespace HyprZones
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Stats.hpp"
+#include "Trace.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace HyprZones {
+
+struct ReplayEvent {
+    size_t          record    = 0;   // index into Trace::records
+    TraceRecordType type      = TraceRecordType::Motion;
+    int64_t         timeNs    = 0;   // recorded time
+    uint64_t        latencyNs = 0;   // DragInput time on replay
+    int             zone      = -1;  // zone under the cursor after the event
+};
+
+struct ReplayResult {
+    std::vector<ReplayEvent> events;
+    std::vector<TraceSnap>   snaps;           // drop decisions made on replay
+    size_t                   mismatches = 0;  // replayed snaps that differ from the recorded ones
+    size_t                   damages    = 0;  // damage requests the drag logic issued
+    double                   damageArea = 0;  // logical pixels those requests covered
+    LatencyHistogram         motion;
+    LatencyHistogram         button;
+};
+
+// Run a trace through DragInput against a fake compositor answering from
+// the recorded monitors, and compare its drop decisions with the recorded
+// ones.
+ReplayResult replayTrace(const Trace& trace);
+
+}  // namespace HyprZones
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace HyprZones {
+
+// Target rectangle for a window in global layout coordinates
+struct GeometryBox {
+    double x = 0;
+    double y = 0;
+    double w = 0;
+    double h = 0;
+
+    bool operator==(const GeometryBox&) const = default;
+};
+
+struct GeometryRequest {
+    void*       window = nullptr;  // PHLWINDOW
+    GeometryBox box;
+
+    bool operator==(const GeometryRequest&) const = default;
+};
+
+// Applies target boxes to windows. The compositor implementation lives in
+// the plugin (HyprlandGeometryBackend); MockGeometryBackend records requests
+// so snapping can be measured without a compositor.
+class WindowGeometryBackend {
+  public:
+    virtual ~WindowGeometryBackend() = default;
+
+    // Returns false if the window could not be placed
+    virtual bool apply(void* window, const GeometryBox& box) = 0;
+
+    // Place many windows in one go; returns the number placed
+    virtual size_t applyBatch(std::span<const GeometryRequest> requests) {
+        size_t applied = 0;
+        for (const auto& request : requests) {
+            applied += apply(request.window, request.box) ? 1 : 0;
+        }
+        return applied;
+    }
+};
+
+class MockGeometryBackend : public WindowGeometryBackend {
+  public:
+    bool apply(void* window, const GeometryBox& box) override {
+        m_applied.push_back({window, box});
+        return window != nullptr;
+    }
+
+    size_t applyBatch(std::span<const GeometryRequest> requests) override {
+        ++m_batches;
+        return WindowGeometryBackend::applyBatch(requests);
+    }
+
+    const std::vector<GeometryRequest>& applied() const { return m_applied; }
+    size_t                              batchCount() const { return m_batches; }
+
+    void clear() {
+        m_applied.clear();
+        m_batches = 0;
+    }
+
+  private:
+    std::vector<GeometryRequest> m_applied;
+    size_t                       m_batches = 0;
+};
+
+}  // namespace HyprZones
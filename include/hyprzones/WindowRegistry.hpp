@@ -0,0 +1,30 @@
+#pragma once
+
+#define WLR_USE_UNSTABLE
+#include <hyprland/src/desktop/DesktopTypes.hpp>
+
+#include "FlatPtrMap.hpp"
+
+namespace HyprZones {
+
+// Weak handles to compositor windows keyed by raw window pointer.
+// Filled from window-open events, evicted on window close, so the snap
+// path turns a raw pointer back into a PHLWINDOW in O(1).
+class WindowRegistry {
+  public:
+    // Register all windows that existed before the plugin loaded
+    void seed();
+
+    void add(const PHLWINDOW& window);
+    void remove(void* window);
+
+    // Live window for a raw pointer, nullptr if unknown or already gone
+    PHLWINDOW get(void* window);
+
+    size_t size() const { return m_windows.size(); }
+
+  private:
+    FlatPtrMap<PHLWINDOWREF> m_windows;
+};
+
+}  // namespace HyprZones
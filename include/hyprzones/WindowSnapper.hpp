@@ -1,42 +1,83 @@
 #pragma once
 
 #include "Layout.hpp"
-#include <vector>
+#include "ZoneSelection.hpp"
+#include "FlatPtrMap.hpp"
+#include "WindowGeometryBackend.hpp"
+#include <span>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 namespace HyprZones {
 
+// What the user chose for a window: the monitor, layout and zones it was
+// snapped to, and where it was before. Re-snaps place the window from this
+// but never write back, so switching through layouts loses nothing.
 struct WindowMemory {
-    std::string      layoutName;
-    std::vector<int> zoneIndices;
-    double           originalX = 0;
-    double           originalY = 0;
-    double           originalW = 0;
-    double           originalH = 0;
+    std::string   monitor;
+    std::string   layoutName;
+    ZoneSelection zones;
+    double        originalX = 0;
+    double        originalY = 0;
+    double        originalW = 0;
+    double        originalH = 0;
+    bool          released  = false;  // to be forgotten by forgetReleased()
 };
 
+class ZoneManager;
+
 class WindowSnapper {
   public:
-    // Snap window to zone(s)
-    void snapToZones(void* window, const Layout& layout,
-                     const std::vector<int>& zoneIndices);
+    explicit WindowSnapper(ZoneManager& zoneManager) : m_zoneManager(zoneManager) {}
+
+    // Placement of a window on zone(s) of a resolved layout; updates the
+    // window's memory if it has one. Returns false if the zones have no area.
+    bool snapToZones(void* window, const Layout& layout,
+                     const ZoneSelection& zones, GeometryRequest& out);
+
+    // Placement of a remembered window on the resolved layout of the monitor
+    // it is on now; the memory is left as it is. Zones remembered on another
+    // layout are carried over by index (missing ones dropped); with none left
+    // there the window goes back to its original geometry. A window whose own
+    // layout lost all its zones in a reload gets the same placement and is
+    // released. A window moved to another monitor is released unplaced.
+    bool resnap(void* window, const std::string& monitor, const Layout& layout, GeometryRequest& out);
 
     // Unsnap window (restore original size/position)
     void unsnap(void* window);
 
     // Memory management
-    void        rememberWindow(void* window, const std::string& layoutName,
-                               const std::vector<int>& zoneIndices,
+    void        rememberWindow(void* window, const std::string& monitor, const std::string& layoutName,
+                               const ZoneSelection& zones,
                                double origX, double origY, double origW, double origH);
     void        forgetWindow(void* window);
     WindowMemory* getMemory(void* window);
 
-    // Restore all windows to remembered zones
-    void restoreAll(const Layout& layout);
+    // A reload moved zones of a layout: translate remembered zone indices
+    // (oldToNew[i] < 0 drops zone i)
+    void remapZones(const std::string& layoutName, std::span<const int> oldToNew);
+
+    // Placements for all windows remembered on this layout (see resnap)
+    void restoreAll(const Layout& layout, std::vector<GeometryRequest>& batch);
+
+    // Drop the memory of windows resnap() released; after a batch of
+    // resnaps, which must not erase while iterating. Returns the count.
+    size_t forgetReleased();
+
+    // Call fn(window, memory) for every remembered window
+    template <typename Fn>
+    void forEachWindow(Fn&& fn) {
+        m_memory.forEach(fn);
+    }
+
+    size_t memorySize() const { return m_memory.size(); }
 
   private:
-    std::unordered_map<void*, WindowMemory> m_memory;
+    ZoneManager&             m_zoneManager;
+    FlatPtrMap<WindowMemory> m_memory;  // keyed by window pointer, pruned on window close
+
+    // Box of the zones, without touching the memory
+    bool placeOnZones(void* window, const Layout& layout, const ZoneSelection& zones, GeometryRequest& out);
 };
 
 }  // namespace HyprZones
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 
 namespace HyprZones {
@@ -25,6 +27,13 @@ struct Zone {
                py >= pixelY && py < pixelY + pixelH;
     }
 
+    // Distance from the point to the nearest edge, 0 inside
+    double distanceTo(double px, double py) const {
+        double dx = std::max({pixelX - px, 0.0, px - (pixelX + pixelW)});
+        double dy = std::max({pixelY - py, 0.0, py - (pixelY + pixelH)});
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
     double area() const {
         return pixelW * pixelH;
     }
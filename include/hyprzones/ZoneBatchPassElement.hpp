@@ -0,0 +1,51 @@
+#pragma once
+
+#include "OverlayMesh.hpp"
+#include <hyprland/src/render/OpenGL.hpp>
+#include <hyprland/src/render/pass/PassElement.hpp>
+#include <vector>
+
+namespace HyprZones {
+
+// GPU side of one monitor's overlay: the meshes and the vertex buffers they
+// are uploaded to, re-uploaded only when a mesh version changed
+struct ZoneBatch {
+    OverlayMesh mesh;
+    GLuint      vao      = 0;
+    GLuint      vbo      = 0;
+    uint64_t    uploaded = 0;  // mesh version currently in vbo
+
+    OverlayTextMesh     text;
+    GLuint              textVao      = 0;
+    GLuint              textVbo      = 0;
+    uint64_t            textUploaded = 0;  // text version currently in textVbo
+    GLuint              atlas        = 0;  // digit atlas the badges sample; owned by the Renderer
+    std::vector<GLuint> labelTextures;     // one per label of text, in order; owned by the label cache
+    float               textAlpha    = 1.0f;
+};
+
+// Every zone fill and border of one overlay in a single draw call, every
+// number badge in one more from the digit atlas and one per zone name,
+// instead of a rect and a border pass element (and a gradient) per zone
+// and a texture pass element per badge cell and label. Holds a reference:
+// the batch is owned by the Renderer and outlives the frame.
+class ZoneBatchPassElement : public IPassElement {
+  public:
+    explicit ZoneBatchPassElement(ZoneBatch& batch) : m_batch(batch) {}
+
+    void        draw(const CRegion& damage) override;
+    bool        needsLiveBlur() override { return false; }
+    bool        needsPrecomputeBlur() override { return false; }
+    const char* passName() override { return "ZoneBatchPassElement"; }
+
+  private:
+    ZoneBatch& m_batch;
+};
+
+// Delete the batch's vertex buffers (makes the compositor's context current)
+void releaseZoneBatch(ZoneBatch& batch);
+
+// Delete the shaders shared by all batches; on plugin unload
+void releaseZoneBatchShader();
+
+}  // namespace HyprZones
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "ZoneSelection.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace HyprZones {
+
+struct Zone;
+
+enum class Direction : uint8_t {
+    Left,
+    Right,
+    Up,
+    Down,
+};
+
+// "l"/"left", "r"/"right", "u"/"up", "d"/"down"; false otherwise
+bool directionFromName(std::string_view name, Direction& out);
+
+// Which zones touch which, from the layout's percent rects (pixel rects have
+// gaps between zones). Built once per resolved layout; answers neighbor
+// lookups in O(1) and span queries in O(zones in the span).
+class ZoneGraph {
+  public:
+    // Edges closer than this (in layout fractions) count as shared
+    static constexpr double EDGE_EPSILON = 1e-4;
+
+    void build(const std::vector<Zone>& zones);
+    void clear();
+
+    bool covers(const std::vector<Zone>& zones) const { return m_built && m_neighbors.size() == zones.size(); }
+
+    // Zone across the given edge with the longest shared stretch, -1 if none
+    int neighbor(int zone, Direction dir) const;
+
+    // Neighbor of a selection: steps from the selected zone furthest in
+    // that direction. -1 if the selection is empty or at the layout edge.
+    int neighbor(const std::vector<Zone>& zones, const ZoneSelection& from, Direction dir) const;
+
+    // Every zone sharing an edge with this one
+    std::span<const uint32_t> adjacent(int zone) const;
+
+    // Smallest zone-aligned rectangle containing both zones: the zones it
+    // overlaps, grown until none sticks out. Walks only zones in (or next
+    // to) the result.
+    void spanRect(const std::vector<Zone>& zones, int a, int b, ZoneSelection& out) const;
+
+  private:
+    bool                                m_built = false;
+    std::vector<std::array<int32_t, 4>> m_neighbors;      // by Direction
+    std::vector<uint32_t>               m_adjacentStart;  // zones + 1 offsets into m_adjacent
+    std::vector<uint32_t>               m_adjacent;
+};
+
+}  // namespace HyprZones
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace HyprZones {
+
+struct Zone;
+
+// Uniform grid over zone pixel rects for point hit-testing.
+// Each cell lists the zones overlapping it, sorted by (area, index), so the
+// first containing zone in a cell is the smallest one at that point.
+class ZoneIndex {
+  public:
+    // Rebuild from zone pixel rects (call after pixels change)
+    void build(const std::vector<Zone>& zones);
+    void clear();
+
+    // True if built for exactly this zone count
+    bool covers(const std::vector<Zone>& zones) const {
+        return m_zoneCount == zones.size() && !m_cellStart.empty();
+    }
+
+    // Smallest zone containing the point, -1 if none
+    int smallestAt(const std::vector<Zone>& zones, double px, double py) const;
+
+    // Zone nearest to the point within maxDistance, -1 if none; ties go to
+    // the smaller zone
+    int nearestWithin(const std::vector<Zone>& zones, double px, double py, double maxDistance) const;
+
+    // All zones containing the point, ascending index order
+    void zonesAt(const std::vector<Zone>& zones, double px, double py, std::vector<int>& out) const;
+
+  private:
+    double m_originX = 0;
+    double m_originY = 0;
+    double m_cellW   = 1;
+    double m_cellH   = 1;
+    int    m_cols    = 0;
+    int    m_rows    = 0;
+    size_t m_zoneCount = 0;
+
+    std::vector<uint32_t> m_cellStart;  // m_cols * m_rows + 1 offsets into m_cellZones
+    std::vector<uint32_t> m_cellZones;  // zone indices per cell
+
+    int  cellColumn(double px) const;
+    int  cellRow(double py) const;
+    bool cellOf(double px, double py, int& outCell) const;
+};
+
+}  // namespace HyprZones
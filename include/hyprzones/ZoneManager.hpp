@@ -1,6 +1,11 @@
 #pragma once
 
 #include "Layout.hpp"
+#include "ResolvedLayout.hpp"
+#include "ZoneSelection.hpp"
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace HyprZones {
@@ -11,18 +16,39 @@ class ZoneManager {
     void computeZonePixels(Layout& layout, double monitorX, double monitorY,
                            double monitorW, double monitorH, int spacingH, int spacingV);
 
+    // Resolved layout for a monitor; rebuilt only when layout generation or
+    // monitor geometry changed since the last call for that monitor
+    std::shared_ptr<const ResolvedLayout> resolveLayout(const std::string& monitorName,
+                                                        const Layout& layout,
+                                                        const MonitorGeometry& monitor);
+
+    // Uncached resolution (for layouts not shown on the monitor right now)
+    std::shared_ptr<const ResolvedLayout> buildResolvedLayout(const Layout& layout,
+                                                              const MonitorGeometry& monitor);
+
+    // Drop cached resolutions (one monitor, or all)
+    void invalidateResolved(const std::string& monitorName);
+    void invalidateAllResolved();
+
     // Find which zone(s) contain a point
     std::vector<int> getZonesAtPoint(const Layout& layout, double px, double py);
 
     // Get smallest zone at point (for overlapping zones)
     int getSmallestZoneAtPoint(const Layout& layout, double px, double py);
 
-    // Get zone range between two zones (for multi-zone selection)
-    std::vector<int> getZoneRange(const Layout& layout, int startZone, int endZone);
+    // Zone nearest to the point within maxDistance (gaps and margins), -1 if none
+    int getNearestZone(const Layout& layout, double px, double py, double maxDistance);
+
+    // Zones spanned by a multi-zone drag: the smallest zone-aligned
+    // rectangle containing both zones
+    void getZoneRange(const ResolvedLayout& resolved, int startZone, int endZone, ZoneSelection& out);
 
     // Get combined bounding box for multiple zones
-    void getCombinedZoneBox(const Layout& layout, const std::vector<int>& indices,
+    void getCombinedZoneBox(const Layout& layout, const ZoneSelection& zones,
                             double& outX, double& outY, double& outW, double& outH);
+
+  private:
+    std::unordered_map<std::string, std::shared_ptr<const ResolvedLayout>> m_resolved;
 };
 
 }  // namespace HyprZones
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace HyprZones {
+
+// Fixed-capacity set of zone indices backed by an inline bitset.
+// Never allocates, so the drag loop, window memory and the renderer can
+// share and copy selections freely. Indices >= CAPACITY are ignored, so
+// config loading caps layouts at CAPACITY zones and reports the rest.
+class ZoneSelection {
+  public:
+    static constexpr int CAPACITY = 1024;
+
+    void clear() {
+        m_bits.fill(0);
+        m_count = 0;
+    }
+
+    bool empty() const { return m_count == 0; }
+    int  size() const { return m_count; }
+
+    bool contains(int zone) const {
+        if (zone < 0 || zone >= CAPACITY)
+            return false;
+        return (m_bits[zone >> 6] >> (zone & 63)) & 1u;
+    }
+
+    // Returns false if the index is out of range
+    bool add(int zone) {
+        if (zone < 0 || zone >= CAPACITY)
+            return false;
+        uint64_t bit = uint64_t{1} << (zone & 63);
+        if (!(m_bits[zone >> 6] & bit)) {
+            m_bits[zone >> 6] |= bit;
+            ++m_count;
+        }
+        return true;
+    }
+
+    // Replace the selection with a single zone
+    void set(int zone) {
+        clear();
+        add(zone);
+    }
+
+    // Smallest selected index, -1 if empty
+    int first() const {
+        for (size_t w = 0; w < m_bits.size(); ++w) {
+            if (m_bits[w])
+                return static_cast<int>(w * 64 + std::countr_zero(m_bits[w]));
+        }
+        return -1;
+    }
+
+    // Call fn(index) for every selected zone in ascending order
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (size_t w = 0; w < m_bits.size(); ++w) {
+            uint64_t word = m_bits[w];
+            while (word) {
+                fn(static_cast<int>(w * 64 + std::countr_zero(word)));
+                word &= word - 1;
+            }
+        }
+    }
+
+    // Allocating copy for IPC and persistence paths
+    std::vector<int> toVector() const {
+        std::vector<int> out;
+        out.reserve(m_count);
+        forEach([&](int zone) { out.push_back(zone); });
+        return out;
+    }
+
+    bool operator==(const ZoneSelection&) const = default;
+
+  private:
+    std::array<uint64_t, CAPACITY / 64> m_bits{};
+    int                                 m_count = 0;
+};
+
+}  // namespace HyprZones
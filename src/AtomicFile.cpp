@@ -0,0 +1,76 @@
+#include "hyprzones/AtomicFile.hpp"
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <unistd.h>
+
+namespace HyprZones {
+
+static bool fail(std::string* error, const std::string& what) {
+    if (error) {
+        *error = what + ": " + std::strerror(errno);
+    }
+    return false;
+}
+
+bool writeFileAtomic(const std::string& path, std::string_view data, std::string* error, bool durable) {
+    std::filesystem::path target(path);
+    std::filesystem::path dir = target.has_parent_path() ? target.parent_path() : ".";
+
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+
+    // Unique per writer, so concurrent saves never share a temp file
+    static std::atomic<uint32_t> counter{0};
+    std::string tmpPath = path + ".tmp." + std::to_string(getpid()) + "." +
+                          std::to_string(counter.fetch_add(1, std::memory_order_relaxed));
+
+    int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return fail(error, "cannot create " + tmpPath);
+    }
+
+    const char* p    = data.data();
+    size_t      left = data.size();
+    while (left > 0) {
+        ssize_t n = write(fd, p, left);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            fail(error, "write " + tmpPath);
+            close(fd);
+            unlink(tmpPath.c_str());
+            return false;
+        }
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+
+    if (durable && fsync(fd) != 0) {
+        fail(error, "fsync " + tmpPath);
+        close(fd);
+        unlink(tmpPath.c_str());
+        return false;
+    }
+    close(fd);
+
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        fail(error, "rename to " + path);
+        unlink(tmpPath.c_str());
+        return false;
+    }
+
+    // Persist the rename itself
+    int dirFd = durable ? open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC) : -1;
+    if (dirFd >= 0) {
+        fsync(dirFd);
+        close(dirFd);
+    }
+    return true;
+}
+
+}  // namespace HyprZones
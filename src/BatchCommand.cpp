@@ -0,0 +1,174 @@
+#include "hyprzones/BatchCommand.hpp"
+#include <charconv>
+
+namespace HyprZones {
+
+namespace {
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Whitespace-separated tokens; a double-quoted token may contain spaces
+bool tokenize(std::string_view text, std::vector<std::string_view>& out) {
+    out.clear();
+    size_t i = 0;
+    while (i < text.size()) {
+        if (isSpace(text[i])) {
+            ++i;
+            continue;
+        }
+        if (text[i] == '"') {
+            size_t close = text.find('"', i + 1);
+            if (close == std::string_view::npos)
+                return false;
+            out.push_back(text.substr(i + 1, close - i - 1));
+            i = close + 1;
+            continue;
+        }
+        size_t start = i;
+        while (i < text.size() && !isSpace(text[i])) ++i;
+        out.push_back(text.substr(start, i - start));
+    }
+    return true;
+}
+
+bool parseInt(std::string_view text, int& out) {
+    auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+    return ec == std::errc() && ptr == text.data() + text.size() && out >= 0;
+}
+
+// "0x55d3c0a1b2c0", "55d3c0a1b2c0" or "address:0x55d3c0a1b2c0"
+bool parseAddress(std::string_view text, uintptr_t& out) {
+    if (text.starts_with("address:"))
+        text.remove_prefix(8);
+    if (text.starts_with("0x") || text.starts_with("0X"))
+        text.remove_prefix(2);
+    auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), out, 16);
+    return !text.empty() && ec == std::errc() && ptr == text.data() + text.size() && out != 0;
+}
+
+// "3" or "2-5" (either order)
+bool parseZones(std::string_view text, int& start, int& end) {
+    size_t dash = text.find('-');
+    if (dash == std::string_view::npos) {
+        if (!parseInt(text, start))
+            return false;
+        end = start;
+        return true;
+    }
+    return parseInt(text.substr(0, dash), start) && parseInt(text.substr(dash + 1), end);
+}
+
+void parseOperation(const std::vector<std::string_view>& tokens, BatchOperation& op) {
+    std::string_view verb = tokens[0];
+    size_t           args = tokens.size() - 1;
+
+    if (verb == "moveto") {
+        op.op = BatchOp::MoveTo;
+        if (args < 2 || args > 3) {
+            op.error = "usage: moveto <address> <zone>[-<zone>] [<layout>]";
+        } else if (!parseAddress(tokens[1], op.window)) {
+            op.error = "invalid window address: " + std::string(tokens[1]);
+        } else if (!parseZones(tokens[2], op.zoneStart, op.zoneEnd)) {
+            op.error = "invalid zone: " + std::string(tokens[2]);
+        } else if (args == 3) {
+            op.layout = tokens[3];
+        }
+    } else if (verb == "layout") {
+        op.op = BatchOp::Layout;
+        if (args == 1) {
+            op.layout = tokens[1];
+        } else if (args == 2) {
+            op.monitor = tokens[1];
+            op.layout  = tokens[2];
+        } else {
+            op.error = "usage: layout [<monitor>] <layout>";
+        }
+    } else if (verb == "show" || verb == "hide") {
+        op.op = verb == "show" ? BatchOp::Show : BatchOp::Hide;
+        if (args > 0)
+            op.error = std::string(verb) + " takes no arguments";
+    } else {
+        op.error = "unknown operation: " + std::string(verb);
+    }
+}
+
+void appendJsonString(std::string& out, std::string_view text) {
+    static constexpr char HEX[] = "0123456789abcdef";
+    out += '"';
+    for (char c : text) {
+        auto u = static_cast<unsigned char>(c);
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (u < 0x20) {
+            out += "\\u00";
+            out += HEX[u >> 4];
+            out += HEX[u & 15];
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+}  // namespace
+
+const char* batchOpName(BatchOp op) {
+    switch (op) {
+        case BatchOp::MoveTo: return "moveto";
+        case BatchOp::Layout: return "layout";
+        case BatchOp::Show: return "show";
+        case BatchOp::Hide: return "hide";
+        case BatchOp::Invalid: break;
+    }
+    return "invalid";
+}
+
+std::vector<BatchOperation> parseBatch(std::string_view text) {
+    std::vector<BatchOperation>   operations;
+    std::vector<std::string_view> tokens;
+
+    while (!text.empty()) {
+        size_t           end  = text.find_first_of(";\n");
+        std::string_view part = text.substr(0, end);
+        text = end == std::string_view::npos ? std::string_view{} : text.substr(end + 1);
+
+        if (!tokenize(part, tokens)) {
+            operations.push_back({});
+            operations.back().error = "unterminated quote";
+            continue;
+        }
+        if (tokens.empty())
+            continue;
+
+        operations.emplace_back();
+        parseOperation(tokens, operations.back());
+    }
+    return operations;
+}
+
+std::string formatBatchResults(const std::vector<BatchOperation>& operations) {
+    std::string out;
+    out.reserve(2 + operations.size() * 32);
+    out += '[';
+    for (size_t i = 0; i < operations.size(); ++i) {
+        const auto& op = operations[i];
+        if (i > 0)
+            out += ',';
+        out += "{\"op\":\"";
+        out += batchOpName(op.op);
+        if (op.error.empty()) {
+            out += "\",\"ok\":true}";
+        } else {
+            out += "\",\"ok\":false,\"error\":";
+            appendJsonString(out, op.error);
+            out += '}';
+        }
+    }
+    out += ']';
+    return out;
+}
+
+}  // namespace HyprZones
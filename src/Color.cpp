@@ -1,4 +1,5 @@
 #include "hyprzones/Color.hpp"
+#include <charconv>
 #include <cstdlib>
 
 namespace HyprZones {
@@ -30,4 +31,74 @@ Color Color::fromHex(const std::string& hex) {
     return c;
 }
 
+bool Color::parse(std::string_view text, Color& out) {
+    auto trim = [](std::string_view v) {
+        while (!v.empty() && (v.front() == ' ' || v.front() == '\t')) v.remove_prefix(1);
+        while (!v.empty() && (v.back() == ' ' || v.back() == '\t')) v.remove_suffix(1);
+        return v;
+    };
+
+    text = trim(text);
+
+    // Hex: #rrggbb / #rrggbbaa
+    if (!text.empty() && text.front() == '#') {
+        text.remove_prefix(1);
+        if (text.size() != 6 && text.size() != 8) {
+            return false;
+        }
+        float channels[4] = {0, 0, 0, 1.0f};
+        for (size_t i = 0; i < text.size() / 2; ++i) {
+            unsigned value = 0;
+            auto [ptr, ec] = std::from_chars(text.data() + i * 2, text.data() + i * 2 + 2, value, 16);
+            if (ec != std::errc() || ptr != text.data() + i * 2 + 2) {
+                return false;
+            }
+            channels[i] = static_cast<float>(value) / 255.0f;
+        }
+        out = {channels[0], channels[1], channels[2], channels[3]};
+        return true;
+    }
+
+    // Functional: rgb(r, g, b) / rgba(r, g, b, a)
+    bool hasAlpha = text.starts_with("rgba(");
+    if (!hasAlpha && !text.starts_with("rgb(")) {
+        return false;
+    }
+    if (text.back() != ')') {
+        return false;
+    }
+    text = text.substr(hasAlpha ? 5 : 4);
+    text.remove_suffix(1);
+
+    // Hyprland style: rgba(rrggbbaa) / rgb(rrggbb)
+    if (text.find(',') == std::string_view::npos) {
+        text = trim(text);
+        if (text.size() != (hasAlpha ? 8u : 6u)) {
+            return false;
+        }
+        std::string hex = "#";
+        hex.append(text);
+        return parse(hex, out);
+    }
+
+    double values[4] = {0, 0, 0, 1.0};
+    int    expected  = hasAlpha ? 4 : 3;
+    for (int i = 0; i < expected; ++i) {
+        size_t           comma = text.find(',');
+        std::string_view token = trim(text.substr(0, comma));
+        auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), values[i]);
+        if (ec != std::errc() || ptr != token.data() + token.size()) {
+            return false;
+        }
+        if ((comma == std::string_view::npos) != (i == expected - 1)) {
+            return false;
+        }
+        text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+    }
+
+    out = {static_cast<float>(values[0] / 255.0), static_cast<float>(values[1] / 255.0),
+           static_cast<float>(values[2] / 255.0), static_cast<float>(values[3])};
+    return true;
+}
+
 }  // namespace HyprZones
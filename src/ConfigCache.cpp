@@ -0,0 +1,452 @@
+#include "hyprzones/ConfigCache.hpp"
+#include "hyprzones/AtomicFile.hpp"
+#include "hyprzones/MappedFile.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+// Binary config snapshot: a fixed header followed by arrays of POD records
+// and one string pool. Every section is 8-byte aligned, so after validation
+// the mapped file is read in place without any text parsing.
+
+namespace HyprZones {
+
+namespace {
+
+constexpr char     CACHE_MAGIC[8] = {'H', 'Z', 'C', 'A', 'C', 'H', 'E', '\0'};
+constexpr uint32_t CACHE_VERSION  = 4;
+
+struct StrRef {
+    uint32_t offset = 0;  // into the string pool
+    uint32_t length = 0;
+};
+
+struct Span {
+    uint64_t offset = 0;  // from the start of the file
+    uint64_t count  = 0;  // records (bytes for the string pool)
+};
+
+struct GeneralRecord {
+    StrRef  snapModifier;
+    Color   highlightColor;
+    Color   borderColor;
+    Color   inactiveColor;
+    Color   numberColor;
+    int32_t borderWidth;
+    int32_t sensitivityRadius;
+    uint8_t showOnDrag;
+    uint8_t requireModifier;
+    uint8_t showZoneNumbers;
+    uint8_t moveToLastKnownZone;
+    uint8_t restoreSizeOnUnsnap;
+    uint8_t allowMultiZone;
+    uint8_t flashOnLayoutChange;
+    uint8_t showZoneNames;
+};
+
+struct LayoutRecord {
+    StrRef   name;
+    StrRef   hotkey;
+    StrRef   templateType;
+    int32_t  spacingH;
+    int32_t  spacingV;
+    int32_t  columns;
+    int32_t  rows;
+    uint32_t firstZone;
+    uint32_t zoneCount;
+};
+
+struct ZoneRecord {
+    StrRef  name;
+    int32_t index;
+    int32_t pad;
+    double  x;
+    double  y;
+    double  width;
+    double  height;
+};
+
+struct MappingRecord {
+    StrRef monitor;
+    StrRef workspaces;
+    StrRef layout;
+};
+
+struct MonitorRecord {
+    StrRef  monitor;
+    int32_t reservedTop;
+    int32_t reservedBottom;
+    int32_t reservedLeft;
+    int32_t reservedRight;
+};
+
+struct CompiledRecord {
+    StrRef   monitor;
+    uint64_t layoutIdx;
+    int64_t  workspaceCount;
+    uint64_t order;
+    uint32_t firstRange;
+    uint32_t rangeCount;
+};
+
+struct RangeRecord {
+    int32_t start;
+    int32_t end;
+};
+
+struct CacheHeader {
+    char          magic[8];
+    uint32_t      version;
+    uint32_t      headerSize;
+    uint64_t      fileSize;
+    uint64_t      sourceSize;
+    int64_t       sourceMtimeSec;
+    int64_t       sourceMtimeNsec;
+    uint64_t      sourceHash;
+    StrRef        sourcePath;
+    GeneralRecord general;
+    Span          layouts;
+    Span          zones;
+    Span          mappings;
+    Span          monitors;
+    Span          compiled;
+    Span          ranges;
+    Span          strings;
+};
+
+static_assert(std::is_trivially_copyable_v<CacheHeader>);
+static_assert(std::is_trivially_copyable_v<Color>);
+
+// Serializer: records are collected per section, then laid out back to back
+class CacheWriter {
+  public:
+    StrRef string(std::string_view s) {
+        StrRef ref{static_cast<uint32_t>(m_strings.size()), static_cast<uint32_t>(s.size())};
+        m_strings.append(s);
+        return ref;
+    }
+
+    template <typename T>
+    Span append(std::string& out, const std::vector<T>& records) {
+        align(out);
+        Span span{out.size(), records.size()};
+        out.append(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(T));
+        return span;
+    }
+
+    Span appendStrings(std::string& out) {
+        align(out);
+        Span span{out.size(), m_strings.size()};
+        out.append(m_strings);
+        return span;
+    }
+
+  private:
+    std::string m_strings;
+
+    static void align(std::string& out) {
+        out.resize((out.size() + 7) & ~size_t{7}, '\0');
+    }
+};
+
+// Bounds- and alignment-checked view of a mapped section
+template <typename T>
+const T* sectionAt(std::string_view file, const Span& span) {
+    if (span.offset % alignof(T) != 0 || span.offset > file.size() ||
+        span.count > (file.size() - span.offset) / sizeof(T)) {
+        return nullptr;
+    }
+    return reinterpret_cast<const T*>(file.data() + span.offset);
+}
+
+}  // namespace
+
+uint64_t hashConfigText(std::string_view text) {
+    constexpr uint64_t PRIME = 0x100000001b3ull;
+
+    // FNV-1a over 64-bit words (bytes for the tail), then a final avalanche
+    uint64_t    hash = 0xcbf29ce484222325ull ^ text.size();
+    const char* p    = text.data();
+    size_t      left = text.size();
+    for (; left >= 8; p += 8, left -= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        hash = (hash ^ word) * PRIME;
+        hash ^= hash >> 29;
+    }
+    for (; left > 0; ++p, --left) {
+        hash = (hash ^ static_cast<unsigned char>(*p)) * PRIME;
+    }
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash == 0 ? 1 : hash;  // 0 means "no source"
+}
+
+std::string getConfigCachePath() {
+    const char* xdgCache = std::getenv("XDG_CACHE_HOME");
+    std::string basePath;
+
+    if (xdgCache && *xdgCache) {
+        basePath = xdgCache;
+    } else {
+        const char* home = std::getenv("HOME");
+        basePath = home ? std::string(home) + "/.cache" : "/tmp";
+    }
+
+    return basePath + "/hyprzones/config.bin";
+}
+
+bool loadConfigCache(const std::string& cachePath, const ConfigSource& source,
+                     std::string_view sourceText, Config& out) {
+    MappedFile cache;
+    if (!cache.open(cachePath)) {
+        return false;
+    }
+
+    std::string_view file = cache.view();
+    if (file.size() < sizeof(CacheHeader)) {
+        return false;
+    }
+
+    CacheHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || header.version != CACHE_VERSION ||
+        header.headerSize != sizeof(CacheHeader) || header.fileSize != file.size()) {
+        return false;
+    }
+
+    const char* strings = sectionAt<char>(file, header.strings);
+    if (!strings) {
+        return false;
+    }
+    bool stringsValid = true;
+    auto str = [&](const StrRef& ref) -> std::string_view {
+        if (ref.offset > header.strings.count || ref.length > header.strings.count - ref.offset) {
+            stringsValid = false;
+            return {};
+        }
+        return {strings + ref.offset, ref.length};
+    };
+
+    // Stale check: mtime + size is the fast path, the content hash decides
+    if (str(header.sourcePath) != source.path || header.sourceSize != source.size) {
+        return false;
+    }
+    bool sameMtime = header.sourceMtimeSec == source.mtime.tv_sec && header.sourceMtimeNsec == source.mtime.tv_nsec;
+    if (!sameMtime && hashConfigText(sourceText) != header.sourceHash) {
+        return false;
+    }
+
+    const auto* layouts  = sectionAt<LayoutRecord>(file, header.layouts);
+    const auto* zones    = sectionAt<ZoneRecord>(file, header.zones);
+    const auto* mappings = sectionAt<MappingRecord>(file, header.mappings);
+    const auto* monitors = sectionAt<MonitorRecord>(file, header.monitors);
+    const auto* compiled = sectionAt<CompiledRecord>(file, header.compiled);
+    const auto* ranges   = sectionAt<RangeRecord>(file, header.ranges);
+    if ((!layouts && header.layouts.count) || (!zones && header.zones.count) ||
+        (!mappings && header.mappings.count) || (!monitors && header.monitors.count) ||
+        (!compiled && header.compiled.count) ||
+        (!ranges && header.ranges.count)) {
+        return false;
+    }
+
+    Config config;
+    config.sourceHash = header.sourceHash;
+
+    const auto& g              = header.general;
+    config.snapModifier        = str(g.snapModifier);
+    config.showOnDrag          = g.showOnDrag;
+    config.requireModifier     = g.requireModifier;
+    config.showZoneNumbers     = g.showZoneNumbers;
+    config.showZoneNames       = g.showZoneNames;
+    config.highlightColor      = g.highlightColor;
+    config.borderColor         = g.borderColor;
+    config.inactiveColor       = g.inactiveColor;
+    config.numberColor         = g.numberColor;
+    config.borderWidth         = g.borderWidth;
+    config.moveToLastKnownZone = g.moveToLastKnownZone;
+    config.restoreSizeOnUnsnap = g.restoreSizeOnUnsnap;
+    config.allowMultiZone      = g.allowMultiZone;
+    config.flashOnLayoutChange = g.flashOnLayoutChange;
+    config.sensitivityRadius   = g.sensitivityRadius;
+
+    config.layouts.resize(header.layouts.count);
+    for (size_t i = 0; i < header.layouts.count; ++i) {
+        const auto& rec    = layouts[i];
+        auto&       layout = config.layouts[i];
+        if (rec.firstZone > header.zones.count || rec.zoneCount > header.zones.count - rec.firstZone) {
+            return false;
+        }
+        layout.name         = str(rec.name);
+        layout.hotkey       = str(rec.hotkey);
+        layout.templateType = str(rec.templateType);
+        layout.spacingH     = rec.spacingH;
+        layout.spacingV     = rec.spacingV;
+        layout.columns      = rec.columns;
+        layout.rows         = rec.rows;
+
+        layout.zones.resize(rec.zoneCount);
+        for (uint32_t z = 0; z < rec.zoneCount; ++z) {
+            const auto& zr   = zones[rec.firstZone + z];
+            auto&       zone = layout.zones[z];
+            zone.name   = str(zr.name);
+            zone.index  = zr.index;
+            zone.x      = zr.x;
+            zone.y      = zr.y;
+            zone.width  = zr.width;
+            zone.height = zr.height;
+        }
+    }
+
+    config.mappings.resize(header.mappings.count);
+    for (size_t i = 0; i < header.mappings.count; ++i) {
+        config.mappings[i].monitor    = str(mappings[i].monitor);
+        config.mappings[i].workspaces = str(mappings[i].workspaces);
+        config.mappings[i].layout     = str(mappings[i].layout);
+    }
+
+    config.monitorOverrides.resize(header.monitors.count);
+    for (size_t i = 0; i < header.monitors.count; ++i) {
+        auto& target          = config.monitorOverrides[i];
+        target.monitor        = str(monitors[i].monitor);
+        target.reservedTop    = monitors[i].reservedTop;
+        target.reservedBottom = monitors[i].reservedBottom;
+        target.reservedLeft   = monitors[i].reservedLeft;
+        target.reservedRight  = monitors[i].reservedRight;
+    }
+
+    config.compiledMappings.resize(header.compiled.count);
+    for (size_t i = 0; i < header.compiled.count; ++i) {
+        const auto& rec    = compiled[i];
+        auto&       target = config.compiledMappings[i];
+        if (rec.layoutIdx >= config.layouts.size() || rec.firstRange > header.ranges.count ||
+            rec.rangeCount > header.ranges.count - rec.firstRange) {
+            return false;
+        }
+        target.monitor        = str(rec.monitor);
+        target.layoutIdx      = rec.layoutIdx;
+        target.workspaceCount = rec.workspaceCount;
+        target.order          = rec.order;
+        target.workspaces.reserve(rec.rangeCount);
+        for (uint32_t r = 0; r < rec.rangeCount; ++r) {
+            target.workspaces.emplace_back(ranges[rec.firstRange + r].start, ranges[rec.firstRange + r].end);
+        }
+    }
+
+    if (!stringsValid) {
+        return false;
+    }
+
+    prepareLayouts(config);
+    out = std::move(config);
+    return true;
+}
+
+bool saveConfigCache(const std::string& cachePath, const ConfigSource& source, const Config& config) {
+    CacheWriter writer;
+    CacheHeader header{};
+
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version         = CACHE_VERSION;
+    header.headerSize      = sizeof(CacheHeader);
+    header.sourceSize      = source.size;
+    header.sourceMtimeSec  = source.mtime.tv_sec;
+    header.sourceMtimeNsec = source.mtime.tv_nsec;
+    header.sourceHash      = config.sourceHash;
+    header.sourcePath      = writer.string(source.path);
+
+    auto& g               = header.general;
+    g.snapModifier        = writer.string(config.snapModifier);
+    g.highlightColor      = config.highlightColor;
+    g.borderColor         = config.borderColor;
+    g.inactiveColor       = config.inactiveColor;
+    g.numberColor         = config.numberColor;
+    g.borderWidth         = config.borderWidth;
+    g.sensitivityRadius   = config.sensitivityRadius;
+    g.showOnDrag          = config.showOnDrag;
+    g.requireModifier     = config.requireModifier;
+    g.showZoneNumbers     = config.showZoneNumbers;
+    g.showZoneNames       = config.showZoneNames;
+    g.moveToLastKnownZone = config.moveToLastKnownZone;
+    g.restoreSizeOnUnsnap = config.restoreSizeOnUnsnap;
+    g.allowMultiZone      = config.allowMultiZone;
+    g.flashOnLayoutChange = config.flashOnLayoutChange;
+
+    std::vector<LayoutRecord> layouts;
+    std::vector<ZoneRecord>   zones;
+    layouts.reserve(config.layouts.size());
+    for (const auto& layout : config.layouts) {
+        LayoutRecord rec{};
+        rec.name         = writer.string(layout.name);
+        rec.hotkey       = writer.string(layout.hotkey);
+        rec.templateType = writer.string(layout.templateType);
+        rec.spacingH     = layout.spacingH;
+        rec.spacingV     = layout.spacingV;
+        rec.columns      = layout.columns;
+        rec.rows         = layout.rows;
+        rec.firstZone    = static_cast<uint32_t>(zones.size());
+        rec.zoneCount    = static_cast<uint32_t>(layout.zones.size());
+        layouts.push_back(rec);
+
+        for (const auto& zone : layout.zones) {
+            ZoneRecord zr{};
+            zr.name   = writer.string(zone.name);
+            zr.index  = zone.index;
+            zr.x      = zone.x;
+            zr.y      = zone.y;
+            zr.width  = zone.width;
+            zr.height = zone.height;
+            zones.push_back(zr);
+        }
+    }
+
+    std::vector<MappingRecord> mappings;
+    mappings.reserve(config.mappings.size());
+    for (const auto& mapping : config.mappings) {
+        mappings.push_back({writer.string(mapping.monitor), writer.string(mapping.workspaces),
+                            writer.string(mapping.layout)});
+    }
+
+    std::vector<MonitorRecord> monitors;
+    monitors.reserve(config.monitorOverrides.size());
+    for (const auto& monitor : config.monitorOverrides) {
+        monitors.push_back({writer.string(monitor.monitor), monitor.reservedTop, monitor.reservedBottom,
+                            monitor.reservedLeft, monitor.reservedRight});
+    }
+
+    std::vector<CompiledRecord> compiled;
+    std::vector<RangeRecord>    ranges;
+    compiled.reserve(config.compiledMappings.size());
+    for (const auto& mapping : config.compiledMappings) {
+        CompiledRecord rec{};
+        rec.monitor        = writer.string(mapping.monitor);
+        rec.layoutIdx      = mapping.layoutIdx;
+        rec.workspaceCount = mapping.workspaceCount;
+        rec.order          = mapping.order;
+        rec.firstRange     = static_cast<uint32_t>(ranges.size());
+        rec.rangeCount     = static_cast<uint32_t>(mapping.workspaces.size());
+        compiled.push_back(rec);
+
+        for (const auto& [start, end] : mapping.workspaces) {
+            ranges.push_back({start, end});
+        }
+    }
+
+    std::string out(sizeof(CacheHeader), '\0');
+    header.layouts  = writer.append(out, layouts);
+    header.zones    = writer.append(out, zones);
+    header.mappings = writer.append(out, mappings);
+    header.monitors = writer.append(out, monitors);
+    header.compiled = writer.append(out, compiled);
+    header.ranges   = writer.append(out, ranges);
+    header.strings  = writer.appendStrings(out);
+    header.fileSize = out.size();
+    std::memcpy(out.data(), &header, sizeof(header));
+
+    // A lost cache is rebuilt on the next load, so skip the fsyncs
+    return writeFileAtomic(cachePath, out, nullptr, false);
+}
+
+}  // namespace HyprZones
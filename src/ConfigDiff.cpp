@@ -0,0 +1,106 @@
+#include "hyprzones/ConfigDiff.hpp"
+#include <unordered_map>
+
+namespace HyprZones {
+
+static bool sameZones(const std::vector<Zone>& a, const std::vector<Zone>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].name != b[i].name || a[i].x != b[i].x || a[i].y != b[i].y ||
+            a[i].width != b[i].width || a[i].height != b[i].height) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Everything that feeds pixel resolution or rendering (not generation)
+static bool sameLayoutContent(const Layout& a, const Layout& b) {
+    return a.hotkey == b.hotkey && a.spacingH == b.spacingH && a.spacingV == b.spacingV &&
+           a.templateType == b.templateType && a.columns == b.columns && a.rows == b.rows &&
+           a.columnPercents == b.columnPercents && a.rowPercents == b.rowPercents &&
+           sameZones(a.zones, b.zones);
+}
+
+// Old zone index -> new index by name; returns false if nothing moved
+static bool buildZoneRemap(const Layout& oldLayout, const Layout& newLayout, std::vector<int>& oldToNew) {
+    // name -> new indices with that name, in order
+    std::unordered_map<std::string_view, std::vector<int>> byName;
+    for (size_t i = 0; i < newLayout.zones.size(); ++i) {
+        byName[newLayout.zones[i].name].push_back(static_cast<int>(i));
+    }
+
+    std::unordered_map<std::string_view, size_t> seen;
+    bool                                         moved = oldLayout.zones.size() != newLayout.zones.size();
+    oldToNew.assign(oldLayout.zones.size(), -1);
+    for (size_t i = 0; i < oldLayout.zones.size(); ++i) {
+        std::string_view name       = oldLayout.zones[i].name;
+        size_t           occurrence = seen[name]++;
+        auto             it         = byName.find(name);
+        if (it != byName.end() && occurrence < it->second.size()) {
+            oldToNew[i] = it->second[occurrence];
+        }
+        moved |= oldToNew[i] != static_cast<int>(i);
+    }
+    return moved;
+}
+
+static bool sameCompiled(const CompiledMapping& a, const CompiledMapping& b) {
+    return a.monitor == b.monitor && a.workspaces == b.workspaces && a.layoutIdx == b.layoutIdx &&
+           a.workspaceCount == b.workspaceCount && a.order == b.order;
+}
+
+ConfigDiff diffConfig(const Config& oldConfig, Config& newConfig) {
+    ConfigDiff diff;
+
+    for (auto& layout : newConfig.layouts) {
+        auto it = oldConfig.layoutIndex.find(layout.name);
+        if (it == oldConfig.layoutIndex.end() || it->second >= oldConfig.layouts.size()) {
+            ++diff.added;
+            continue;
+        }
+
+        const Layout& old = oldConfig.layouts[it->second];
+        if (sameLayoutContent(old, layout)) {
+            layout.generation = old.generation;
+            ++diff.unchanged;
+            continue;
+        }
+
+        ++diff.changed;
+        ZoneRemap remap;
+        if (buildZoneRemap(old, layout, remap.oldToNew)) {
+            remap.layout = layout.name;
+            diff.remaps.push_back(std::move(remap));
+        }
+    }
+
+    for (const auto& layout : oldConfig.layouts) {
+        if (!newConfig.layoutIndex.contains(layout.name)) {
+            ++diff.removed;
+        }
+    }
+
+    // Memoized lookups store layout indices: valid only if the compiled
+    // mappings and the layout order (first-layout fallback) are identical
+    bool sameOrder = oldConfig.layouts.size() == newConfig.layouts.size();
+    for (size_t i = 0; sameOrder && i < newConfig.layouts.size(); ++i) {
+        sameOrder = oldConfig.layouts[i].name == newConfig.layouts[i].name;
+    }
+    bool sameMappings = sameOrder && oldConfig.activeLayout == newConfig.activeLayout &&
+                        oldConfig.compiledMappings.size() == newConfig.compiledMappings.size();
+    for (size_t i = 0; sameMappings && i < newConfig.compiledMappings.size(); ++i) {
+        sameMappings = sameCompiled(oldConfig.compiledMappings[i], newConfig.compiledMappings[i]);
+    }
+    diff.mappingsChanged = !sameMappings;
+    if (sameMappings) {
+        newConfig.mappingsGeneration = oldConfig.mappingsGeneration;
+    }
+    diff.monitorsChanged = oldConfig.monitorOverrides != newConfig.monitorOverrides;
+
+    return diff;
+}
+
+}  // namespace HyprZones
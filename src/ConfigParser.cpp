@@ -1,15 +1,17 @@
 #include "hyprzones/Config.hpp"
+#include "hyprzones/ConfigCache.hpp"
+#include "hyprzones/ConfigDiff.hpp"
+#include "hyprzones/ConfigWatcher.hpp"
 #include "hyprzones/Globals.hpp"
 #include "hyprzones/LayoutManager.hpp"
-#include <fstream>
+#include "hyprzones/Log.hpp"
+#include "hyprzones/MappedFile.hpp"
+#include "hyprzones/MonitorTracker.hpp"
+#include "hyprzones/Stats.hpp"
+#include "hyprzones/WindowSnapper.hpp"
+#include "hyprzones/ZoneManager.hpp"
 #include <cstdlib>
 
-// Debug log to file
-static void logToFile(const std::string& msg) {
-    std::ofstream f("/tmp/hyprzones.log", std::ios::app);
-    if (f) f << msg << "\n";
-}
-
 namespace HyprZones {
 
 std::string getConfigPath() {
@@ -26,39 +28,123 @@ std::string getConfigPath() {
     return basePath + "/hypr/hyprzones.toml";
 }
 
-Config loadConfig(const std::string& path) {
-    Config config;
+Config loadConfig(const std::string& path, std::vector<ConfigError>* errors, bool* fromCache) {
+    if (fromCache) {
+        *fromCache = false;
+    }
+
+    MappedFile file;
+    if (!file.open(path)) {
+        HZ_LOG_ERROR("%s: cannot open", path.c_str());
+        if (errors) {
+            *errors = {{0, "cannot open " + path}};
+        }
+        return Config{};
+    }
 
-    if (g_layoutManager) {
-        config.layouts = g_layoutManager->loadLayouts(path);
-        for (size_t i = 0; i < config.layouts.size(); ++i) {
-            config.layoutIndex[config.layouts[i].name] = i;
+    ConfigSource source{path, file.size(), file.mtime()};
+    std::string  cachePath = getConfigCachePath();
+
+    // Compiled snapshot: no parsing and no mapping compilation
+    Config cached;
+    if (loadConfigCache(cachePath, source, file.view(), cached)) {
+        if (fromCache) {
+            *fromCache = true;
         }
-        if (!config.layouts.empty()) {
-            config.activeLayout = config.layouts[0].name;
+        if (errors) {
+            errors->clear();
         }
+        return cached;
+    }
+
+    auto result = parseConfig(file.view());
+    result.config.sourceHash = hashConfigText(file.view());
+
+    for (const auto& error : result.errors) {
+        HZ_LOG_WARN("%s:%d: %s", path.c_str(), error.line, error.message.c_str());
+    }
+
+    LayoutManager::compileMappings(result.config);
+
+    // Only clean configs are cached, so errors are reported on every load
+    if (result.errors.empty() && !saveConfigCache(cachePath, source, result.config)) {
+        HZ_LOG_WARN("Failed to write config cache %s", cachePath.c_str());
+    }
+
+    if (errors) {
+        *errors = std::move(result.errors);
+    }
+    return std::move(result.config);
+}
 
-        config.mappings = g_layoutManager->loadMappings(path);
+ReloadStatus reloadConfig(bool force) {
+    ReloadStatus status;
+    std::string  path = getConfigPath();
+
+    // Unchanged source: keep the current config (and its layout generations)
+    if (!force && g_config && g_config->sourceHash != 0) {
+        MappedFile file;
+        if (file.open(path) && hashConfigText(file.view()) == g_config->sourceHash) {
+            status.unchanged = true;
+            return status;
+        }
     }
 
-    return config;
+    std::vector<ConfigError> errors;
+    auto config   = std::make_shared<Config>(loadConfig(path, &errors, &status.fromCache));
+    status.errors = errors.size();
+    status.placementChanged = publishConfig(std::move(config));
+
+    HZ_LOG_INFO("Config reloaded%s: %zu errors", status.fromCache ? " from cache" : "", errors.size());
+    return status;
 }
 
-void reloadConfig() {
-    g_config = loadConfig(getConfigPath());
+bool publishConfig(std::shared_ptr<Config> config) {
+    ConfigDiff diff;
+    if (g_config) {
+        diff = diffConfig(*g_config, *config);
+    } else {
+        diff.added           = config->layouts.size();
+        diff.mappingsChanged = true;
+    }
 
-    g_config.layoutIndex.clear();
-    for (size_t i = 0; i < g_config.layouts.size(); ++i) {
-        g_config.layoutIndex[g_config.layouts[i].name] = i;
+    for (const auto& remap : diff.remaps) {
+        g_windowSnapper->remapZones(remap.layout, remap.oldToNew);
     }
 
-    // Debug: Log loaded mappings
-    logToFile("[HyprZones] Config reloaded: " + std::to_string(g_config.layouts.size()) +
-              " layouts, " + std::to_string(g_config.mappings.size()) + " mappings");
-    for (const auto& m : g_config.mappings) {
-        logToFile("[HyprZones]   Mapping: monitor=" + m.monitor +
-                  " ws=" + m.workspaces + " -> layout=" + m.layout);
+    // Unchanged mappings kept their generation (diffConfig), so the lookup
+    // memo carries over; changed ones free it. A drag's pinned snapshot has
+    // its own generation and cannot feed its entries to this one.
+    if (diff.mappingsChanged) {
+        g_layoutManager->invalidateMappingCache();
     }
+
+    // Readers that pinned the old snapshot (drag sessions) keep it alive
+    g_config = std::move(config);
+    if (g_configWatcher) {
+        g_configWatcher->setKnownHash(g_config->sourceHash);
+    }
+
+    // New [[monitors]] overrides: drop resolved zones only on monitors whose
+    // usable area actually moved
+    if (diff.monitorsChanged && g_monitorTracker) {
+        std::vector<std::string> changed;
+        g_monitorTracker->reapply(*g_config, changed);
+        for (const auto& name : changed) {
+            g_zoneManager->invalidateResolved(name);
+        }
+        g_stats.count(Counter::UsableAreaChanges, changed.size());
+    }
+
+    HZ_LOG_INFO("Config published: %zu layouts (%zu unchanged, %zu changed, %zu added, %zu removed), %zu mappings",
+                g_config->layouts.size(), diff.unchanged, diff.changed, diff.added, diff.removed,
+                g_config->mappings.size());
+    for (const auto& m : g_config->mappings) {
+        HZ_LOG_DEBUG("  Mapping: monitor=%s ws=%s -> layout=%s", m.monitor.c_str(), m.workspaces.c_str(),
+                     m.layout.c_str());
+    }
+
+    return diff.affectsPlacement();
 }
 
 }  // namespace HyprZones
@@ -0,0 +1,489 @@
+#include "hyprzones/Config.hpp"
+#include "hyprzones/ConfigCache.hpp"
+#include "hyprzones/MappedFile.hpp"
+#include "hyprzones/ZoneSelection.hpp"
+#include <atomic>
+#include <cctype>
+#include <charconv>
+
+// Single-pass reader for hyprzones.toml. Works on string views into the
+// mapped file; only names and other kept strings are copied out.
+
+namespace HyprZones {
+
+namespace {
+
+enum class Section {
+    None,
+    General,
+    Layout,
+    Zone,
+    Mapping,
+    Monitor,
+    Unknown,
+};
+
+std::string_view trim(std::string_view v) {
+    while (!v.empty() && (v.front() == ' ' || v.front() == '\t' || v.front() == '\r')) v.remove_prefix(1);
+    while (!v.empty() && (v.back() == ' ' || v.back() == '\t' || v.back() == '\r')) v.remove_suffix(1);
+    return v;
+}
+
+// Drop a trailing "# comment" that is not inside a quoted string
+std::string_view stripComment(std::string_view line) {
+    bool quoted = false;
+    for (size_t i = 0; i < line.size(); ++i) {
+        if (line[i] == '"') {
+            quoted = !quoted;
+        } else if (line[i] == '#' && !quoted) {
+            return line.substr(0, i);
+        }
+    }
+    return line;
+}
+
+bool parseString(std::string_view value, std::string_view& out) {
+    if (value.size() < 2 || value.front() != '"' || value.back() != '"') {
+        return false;
+    }
+    out = value.substr(1, value.size() - 2);
+    return true;
+}
+
+template <typename T>
+bool parseNumber(std::string_view value, T& out) {
+    if (!value.empty() && value.front() == '+') {
+        value.remove_prefix(1);
+    }
+    auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), out);
+    return ec == std::errc() && ptr == value.data() + value.size();
+}
+
+// Percentage text -> fraction. Parsing "<text>e-2" divides by 100 in
+// decimal, so the writer's output reads back to the exact same double.
+bool parsePercent(std::string_view value, double& out) {
+    char buf[128];
+    if (value.size() + 3 > sizeof(buf) || value.find_first_of("eE") != std::string_view::npos) {
+        double percent = 0;
+        if (!parseNumber(value, percent)) {
+            return false;
+        }
+        out = percent / 100.0;
+        return true;
+    }
+
+    if (!value.empty() && value.front() == '+') {
+        value.remove_prefix(1);
+    }
+    size_t len = value.size();
+    value.copy(buf, len);
+    buf[len++] = 'e';
+    buf[len++] = '-';
+    buf[len++] = '2';
+
+    // Reject what from_chars would accept only thanks to the appended exponent
+    if (value.empty() || !(std::isdigit(static_cast<unsigned char>(value.back())) || value.back() == '.')) {
+        return false;
+    }
+    auto [ptr, ec] = std::from_chars(buf, buf + len, out);
+    return ec == std::errc() && ptr == buf + len;
+}
+
+bool parseNonNegative(std::string_view value, int& out) {
+    int parsed = 0;
+    if (!parseNumber(value, parsed) || parsed < 0) {
+        return false;
+    }
+    out = parsed;
+    return true;
+}
+
+bool parseBool(std::string_view value, bool& out) {
+    if (value == "true") {
+        out = true;
+        return true;
+    }
+    if (value == "false") {
+        out = false;
+        return true;
+    }
+    return false;
+}
+
+bool parseColor(std::string_view value, Color& out) {
+    std::string_view text;
+    return parseString(value, text) ? Color::parse(text, out) : Color::parse(value, out);
+}
+
+class Reader {
+  public:
+    explicit Reader(ConfigParseResult& result) : m_result(result) {}
+
+    void run(std::string_view text) {
+        while (!text.empty()) {
+            size_t           nl   = text.find('\n');
+            std::string_view line = text.substr(0, nl);
+            text = nl == std::string_view::npos ? std::string_view{} : text.substr(nl + 1);
+            ++m_line;
+
+            line = trim(stripComment(line));
+            if (!line.empty()) {
+                handleLine(line);
+            }
+        }
+        flushAll();
+    }
+
+  private:
+    ConfigParseResult& m_result;
+    Config&            m_config = m_result.config;
+    int                m_line   = 0;
+    Section            m_section = Section::None;
+
+    Layout        m_layout;
+    Zone          m_zone;
+    LayoutMapping   m_mapping;
+    MonitorOverride m_monitor;
+    bool            m_haveLayout  = false;
+    bool            m_haveZone    = false;
+    bool            m_haveMapping = false;
+    bool            m_haveMonitor = false;
+
+    // Header lines, so skipped sections are reported where they start
+    int m_layoutLine  = 0;
+    int m_zoneLine    = 0;
+    int m_mappingLine = 0;
+    int m_monitorLine = 0;
+
+    // Zones of the current layout beyond ZoneSelection::CAPACITY
+    size_t m_droppedZones = 0;
+
+    void error(std::string message, int line = -1) {
+        m_result.errors.push_back({line < 0 ? m_line : line, std::move(message)});
+    }
+
+    void invalid(std::string_view key, std::string_view value) {
+        error("invalid value for '" + std::string(key) + "': " + std::string(value));
+    }
+
+    void flushZone() {
+        if (!m_haveZone) {
+            return;
+        }
+        m_haveZone = false;
+        if (m_zone.name.empty()) {
+            error("zone without name skipped", m_zoneLine);
+            return;
+        }
+        // Zone selections are fixed-size bitsets: a zone past their capacity
+        // could never be highlighted, dropped onto or moved to
+        if (m_layout.zones.size() >= static_cast<size_t>(ZoneSelection::CAPACITY)) {
+            ++m_droppedZones;
+            return;
+        }
+        m_zone.index = static_cast<int>(m_layout.zones.size());
+        m_layout.zones.push_back(std::move(m_zone));
+    }
+
+    void flushLayout() {
+        flushZone();
+        if (!m_haveLayout) {
+            return;
+        }
+        m_haveLayout = false;
+        if (m_droppedZones > 0) {
+            error("layout '" + m_layout.name + "': " + std::to_string(m_droppedZones) + " zones past the limit of " +
+                      std::to_string(ZoneSelection::CAPACITY) + " dropped",
+                  m_layoutLine);
+            m_droppedZones = 0;
+        }
+        if (m_layout.name.empty()) {
+            error("layout without name skipped", m_layoutLine);
+            return;
+        }
+        m_config.layouts.push_back(std::move(m_layout));
+    }
+
+    void flushMapping() {
+        if (!m_haveMapping) {
+            return;
+        }
+        m_haveMapping = false;
+        if (m_mapping.layout.empty()) {
+            error("mapping without layout skipped", m_mappingLine);
+            return;
+        }
+        // An omitted monitor must not turn into a catch-all; "*" is explicit
+        if (m_mapping.monitor.empty()) {
+            error("mapping without monitor skipped (use monitor = \"*\" for all)", m_mappingLine);
+            return;
+        }
+        m_config.mappings.push_back(std::move(m_mapping));
+    }
+
+    void flushMonitor() {
+        if (!m_haveMonitor) {
+            return;
+        }
+        m_haveMonitor = false;
+        if (m_monitor.monitor.empty()) {
+            error("monitor override without monitor skipped", m_monitorLine);
+            return;
+        }
+        m_config.monitorOverrides.push_back(std::move(m_monitor));
+    }
+
+    // Every section header ends the sections still open
+    void flushAll() {
+        flushLayout();
+        flushMapping();
+        flushMonitor();
+    }
+
+    void handleLine(std::string_view line) {
+        if (line.front() == '[') {
+            handleHeader(line);
+            return;
+        }
+
+        size_t eq = line.find('=');
+        if (eq == std::string_view::npos) {
+            error("expected 'key = value'");
+            return;
+        }
+        std::string_view key   = trim(line.substr(0, eq));
+        std::string_view value = trim(line.substr(eq + 1));
+
+        switch (m_section) {
+            case Section::General: handleGeneral(key, value); break;
+            case Section::Layout:  handleLayout(key, value); break;
+            case Section::Zone:    handleZone(key, value); break;
+            case Section::Mapping: handleMapping(key, value); break;
+            case Section::Monitor: handleMonitor(key, value); break;
+            case Section::None:    error("key outside of any section: " + std::string(key)); break;
+            case Section::Unknown: break;
+        }
+    }
+
+    void handleHeader(std::string_view header) {
+        if (header == "[[layouts]]") {
+            flushAll();
+            m_layout     = Layout();
+            m_haveLayout = true;
+            m_layoutLine = m_line;
+            m_section    = Section::Layout;
+        } else if (header == "[[layouts.zones]]") {
+            flushZone();
+            if (!m_haveLayout) {
+                error("[[layouts.zones]] before any [[layouts]]");
+                m_section = Section::Unknown;
+                return;
+            }
+            m_zone     = Zone();
+            m_haveZone = true;
+            m_zoneLine = m_line;
+            m_section  = Section::Zone;
+        } else if (header == "[[mappings]]") {
+            flushAll();
+            m_mapping            = LayoutMapping{{}, "*", {}};  // monitor has no default
+            m_haveMapping        = true;
+            m_mappingLine        = m_line;
+            m_section            = Section::Mapping;
+        } else if (header == "[[monitors]]") {
+            flushAll();
+            m_monitor     = MonitorOverride();
+            m_haveMonitor = true;
+            m_monitorLine = m_line;
+            m_section     = Section::Monitor;
+        } else if (header == "[general]") {
+            flushAll();
+            m_section = Section::General;
+        } else {
+            flushAll();
+            error("unknown section " + std::string(header));
+            m_section = Section::Unknown;
+        }
+    }
+
+    void handleGeneral(std::string_view key, std::string_view value) {
+        auto& c  = m_config;
+        bool  ok = true;
+        std::string_view text;
+
+        if (key == "snap_modifier") {
+            ok = parseString(value, text);
+            if (ok)
+                c.snapModifier = text;
+        } else if (key == "show_on_drag") {
+            ok = parseBool(value, c.showOnDrag);
+        } else if (key == "require_modifier") {
+            ok = parseBool(value, c.requireModifier);
+        } else if (key == "show_zone_numbers") {
+            ok = parseBool(value, c.showZoneNumbers);
+        } else if (key == "show_zone_names") {
+            ok = parseBool(value, c.showZoneNames);
+        } else if (key == "zone_highlight_color") {
+            ok = parseColor(value, c.highlightColor);
+        } else if (key == "zone_border_color") {
+            ok = parseColor(value, c.borderColor);
+        } else if (key == "zone_inactive_color") {
+            ok = parseColor(value, c.inactiveColor);
+        } else if (key == "zone_number_color") {
+            ok = parseColor(value, c.numberColor);
+        } else if (key == "zone_border_width") {
+            ok = parseNonNegative(value, c.borderWidth);
+        } else if (key == "move_to_last_known_zone") {
+            ok = parseBool(value, c.moveToLastKnownZone);
+        } else if (key == "restore_size_on_unsnap") {
+            ok = parseBool(value, c.restoreSizeOnUnsnap);
+        } else if (key == "allow_multi_zone") {
+            ok = parseBool(value, c.allowMultiZone);
+        } else if (key == "flash_on_layout_change") {
+            ok = parseBool(value, c.flashOnLayoutChange);
+        } else if (key == "sensitivity_radius") {
+            ok = parseNonNegative(value, c.sensitivityRadius);
+        }
+        // Unknown keys are ignored so newer configs still load
+
+        if (!ok) {
+            invalid(key, value);
+        }
+    }
+
+    void handleLayout(std::string_view key, std::string_view value) {
+        auto& l  = m_layout;
+        bool  ok = true;
+        std::string_view text;
+
+        if (key == "name") {
+            ok = parseString(value, text);
+            if (ok)
+                l.name = text;
+        } else if (key == "hotkey") {
+            ok = parseString(value, text);
+            if (ok)
+                l.hotkey = text;
+        } else if (key == "template") {
+            ok = parseString(value, text);
+            if (ok)
+                l.templateType = text;
+        } else if (key == "spacing_h") {
+            ok = parseNumber(value, l.spacingH);
+        } else if (key == "spacing_v") {
+            ok = parseNumber(value, l.spacingV);
+        } else if (key == "columns") {
+            ok = parseNumber(value, l.columns);
+        } else if (key == "rows") {
+            ok = parseNumber(value, l.rows);
+        }
+
+        if (!ok) {
+            invalid(key, value);
+        }
+    }
+
+    void handleZone(std::string_view key, std::string_view value) {
+        auto& z = m_zone;
+        std::string_view text;
+
+        // Coordinates are percentages in the file, fractions in memory
+        double* target = key == "x"      ? &z.x
+                       : key == "y"      ? &z.y
+                       : key == "width"  ? &z.width
+                       : key == "height" ? &z.height
+                                         : nullptr;
+        if (target) {
+            if (!parsePercent(value, *target)) {
+                invalid(key, value);
+            }
+        } else if (key == "name") {
+            if (parseString(value, text)) {
+                z.name = text;
+            } else {
+                invalid(key, value);
+            }
+        }
+    }
+
+    void handleMapping(std::string_view key, std::string_view value) {
+        std::string* target = key == "monitor"    ? &m_mapping.monitor
+                            : key == "workspaces" ? &m_mapping.workspaces
+                            : key == "layout"     ? &m_mapping.layout
+                                                  : nullptr;
+        if (!target) {
+            return;
+        }
+        std::string_view text;
+        if (parseString(value, text)) {
+            *target = text;
+        } else {
+            invalid(key, value);
+        }
+    }
+
+    void handleMonitor(std::string_view key, std::string_view value) {
+        auto& m = m_monitor;
+        std::string_view text;
+
+        int* target = key == "reserved_top"    ? &m.reservedTop
+                    : key == "reserved_bottom" ? &m.reservedBottom
+                    : key == "reserved_left"   ? &m.reservedLeft
+                    : key == "reserved_right"  ? &m.reservedRight
+                                               : nullptr;
+        if (target) {
+            if (!parseNonNegative(value, *target)) {
+                invalid(key, value);
+            }
+        } else if (key == "monitor") {
+            if (parseString(value, text)) {
+                m.monitor = text;
+            } else {
+                invalid(key, value);
+            }
+        }
+    }
+};
+
+}  // namespace
+
+uint64_t nextConfigGeneration() {
+    static std::atomic<uint64_t> nextGeneration{1};
+    return nextGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+void assignLayoutGenerations(std::vector<Layout>& layouts) {
+    for (auto& layout : layouts) {
+        layout.generation = nextConfigGeneration();
+    }
+}
+
+void prepareLayouts(Config& config) {
+    assignLayoutGenerations(config.layouts);
+    config.mappingsGeneration = nextConfigGeneration();
+    config.layoutIndex.clear();
+    for (size_t i = 0; i < config.layouts.size(); ++i) {
+        config.layoutIndex[config.layouts[i].name] = i;
+    }
+    config.activeLayout = config.layouts.empty() ? "" : config.layouts[0].name;
+}
+
+ConfigParseResult parseConfig(std::string_view text) {
+    ConfigParseResult result;
+    Reader(result).run(text);
+    prepareLayouts(result.config);
+    return result;
+}
+
+ConfigParseResult parseConfigFile(const std::string& path) {
+    MappedFile file;
+    if (!file.open(path)) {
+        ConfigParseResult result;
+        result.errors.push_back({0, "cannot open " + path});
+        return result;
+    }
+    auto result = parseConfig(file.view());
+    result.config.sourceHash = hashConfigText(file.view());
+    return result;
+}
+
+}  // namespace HyprZones
@@ -0,0 +1,91 @@
+#include "hyprzones/ConfigSaver.hpp"
+#include "hyprzones/AtomicFile.hpp"
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace HyprZones {
+
+bool ConfigSaver::start() {
+    stop();
+
+    m_readyFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_readyFd < 0) {
+        return false;
+    }
+
+    m_stopping = false;
+    m_worker   = std::thread([this] { run(); });
+    return true;
+}
+
+void ConfigSaver::stop() {
+    if (m_worker.joinable()) {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_one();
+        m_worker.join();
+    }
+
+    if (m_readyFd >= 0) {
+        close(m_readyFd);
+        m_readyFd = -1;
+    }
+
+    std::lock_guard lock(m_mutex);
+    m_jobs.clear();
+    m_results.clear();
+}
+
+bool ConfigSaver::save(std::string path, std::shared_ptr<const Config> config) {
+    if (!m_worker.joinable() || !config) {
+        return false;
+    }
+    {
+        std::lock_guard lock(m_mutex);
+        m_jobs.push_back({std::move(path), std::move(config)});
+    }
+    m_wake.notify_one();
+    return true;
+}
+
+std::vector<SaveResult> ConfigSaver::takeResults() {
+    uint64_t count;
+    (void)!read(m_readyFd, &count, sizeof(count));
+
+    std::lock_guard lock(m_mutex);
+    return std::move(m_results);
+}
+
+void ConfigSaver::run() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock lock(m_mutex);
+            m_wake.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+            if (m_jobs.empty()) {
+                return;  // stopping, and everything queued is written
+            }
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        SaveResult  result;
+        std::string text = serializeConfig(*job.config);
+        job.config.reset();  // don't hold the snapshot across the fsync
+        result.path  = std::move(job.path);
+        result.bytes = text.size();
+        result.ok    = writeFileAtomic(result.path, text, &result.error);
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_results.push_back(std::move(result));
+        }
+
+        uint64_t one = 1;
+        (void)!write(m_readyFd, &one, sizeof(one));
+    }
+}
+
+}  // namespace HyprZones
@@ -0,0 +1,131 @@
+#include "hyprzones/ConfigWatcher.hpp"
+#include "hyprzones/ConfigCache.hpp"
+#include "hyprzones/MappedFile.hpp"
+#include <cerrno>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace HyprZones {
+
+// Editors often write a file in several steps; wait this long after the
+// last event before loading
+static constexpr int DEBOUNCE_MS = 50;
+
+bool ConfigWatcher::start(const std::string& configPath) {
+    stop();
+
+    size_t      slash = configPath.rfind('/');
+    std::string dir   = slash == std::string::npos ? "." : configPath.substr(0, slash);
+    m_path            = configPath;
+    m_fileName        = slash == std::string::npos ? configPath : configPath.substr(slash + 1);
+
+    m_inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    m_stopFd    = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    m_readyFd   = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_inotifyFd < 0 || m_stopFd < 0 || m_readyFd < 0 ||
+        inotify_add_watch(m_inotifyFd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        stop();
+        return false;
+    }
+
+    m_worker = std::thread([this] { run(); });
+    return true;
+}
+
+void ConfigWatcher::stop() {
+    if (m_worker.joinable()) {
+        uint64_t one = 1;
+        (void)!write(m_stopFd, &one, sizeof(one));
+        m_worker.join();
+    }
+
+    for (int* fd : {&m_inotifyFd, &m_stopFd, &m_readyFd}) {
+        if (*fd >= 0) {
+            close(*fd);
+            *fd = -1;
+        }
+    }
+
+    std::lock_guard lock(m_pendingMutex);
+    m_pending.reset();
+}
+
+std::shared_ptr<Config> ConfigWatcher::takeReady(ReloadStatus* status) {
+    uint64_t count;
+    (void)!read(m_readyFd, &count, sizeof(count));
+
+    std::lock_guard lock(m_pendingMutex);
+    if (status) {
+        *status = m_pendingStatus;
+    }
+    return std::move(m_pending);
+}
+
+void ConfigWatcher::run() {
+    alignas(inotify_event) char buffer[4096];
+    pollfd fds[2] = {{m_inotifyFd, POLLIN, 0}, {m_stopFd, POLLIN, 0}};
+    bool   dirty  = false;
+
+    while (true) {
+        // Block until an event arrives; once dirty, wait only for the debounce window
+        int ready = poll(fds, 2, dirty ? DEBOUNCE_MS : -1);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        if (fds[1].revents & POLLIN) {
+            return;
+        }
+
+        if (ready == 0) {
+            dirty = false;
+            reload();
+            continue;
+        }
+
+        ssize_t len;
+        while ((len = read(m_inotifyFd, buffer, sizeof(buffer))) > 0) {
+            for (char* p = buffer; p < buffer + len;) {
+                auto* event = reinterpret_cast<inotify_event*>(p);
+                if (event->len > 0 && m_fileName == event->name) {
+                    dirty = true;
+                }
+                p += sizeof(inotify_event) + event->len;
+            }
+        }
+    }
+}
+
+void ConfigWatcher::reload() {
+    // Cheap check first: saves that didn't change the content do nothing
+    {
+        MappedFile file;
+        if (!file.open(m_path)) {
+            return;  // deleted or mid-replace; the next event brings it back
+        }
+        if (hashConfigText(file.view()) == m_knownHash.load(std::memory_order_relaxed)) {
+            return;
+        }
+    }
+
+    ReloadStatus             status;
+    std::vector<ConfigError> errors;
+    auto config   = std::make_shared<Config>(loadConfig(m_path, &errors, &status.fromCache));
+    status.errors = errors.size();
+    m_knownHash.store(config->sourceHash, std::memory_order_relaxed);
+
+    {
+        std::lock_guard lock(m_pendingMutex);
+        m_pending       = std::move(config);  // an unconsumed older snapshot is dropped
+        m_pendingStatus = status;
+    }
+
+    uint64_t one = 1;
+    (void)!write(m_readyFd, &one, sizeof(one));
+}
+
+}  // namespace HyprZones
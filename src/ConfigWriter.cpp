@@ -0,0 +1,206 @@
+#include "hyprzones/Config.hpp"
+#include <charconv>
+
+// Serializer for hyprzones.toml, the inverse of ConfigReader. Numbers use
+// std::to_chars' shortest round-trip form, so save + load reproduces the
+// exact in-memory values.
+
+namespace HyprZones {
+
+namespace {
+
+void appendNumber(std::string& out, double value) {
+    char buf[32];
+    auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, ec == std::errc() ? ptr : buf);
+}
+
+void appendNumber(std::string& out, long long value) {
+    char buf[24];
+    auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, ec == std::errc() ? ptr : buf);
+}
+
+// Zone coordinates are stored as fractions but written as percentages.
+// fraction * 100 in floating point can't round-trip every value, so the
+// decimal point of the shortest fraction text is moved two places instead;
+// the reader undoes that textually (see parsePercent).
+void appendPercent(std::string& out, double fraction) {
+    char buf[512];
+    auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), fraction, std::chars_format::fixed);
+    if (ec != std::errc()) {
+        appendNumber(out, fraction * 100.0);
+        return;
+    }
+
+    std::string_view text(buf, ptr);
+    if (!text.empty() && text.front() == '-') {
+        out += '-';
+        text.remove_prefix(1);
+    }
+
+    size_t           dot      = text.find('.');
+    std::string_view intPart  = text.substr(0, dot);
+    std::string_view fracPart = dot == std::string_view::npos ? std::string_view{} : text.substr(dot + 1);
+
+    std::string digits(intPart);
+    for (size_t i = 0; i < 2; ++i) {
+        digits += i < fracPart.size() ? fracPart[i] : '0';
+    }
+    std::string_view rest = fracPart.size() > 2 ? fracPart.substr(2) : std::string_view{};
+
+    size_t lead = digits.find_first_not_of('0');
+    out.append(lead == std::string::npos ? std::string_view("0") : std::string_view(digits).substr(lead));
+    if (!rest.empty()) {
+        out += '.';
+        out += rest;
+    }
+}
+
+// One rgba() channel, written as reader's value for channel * scale. The
+// shortest float text (102 rather than 102.00000151991844) is used when
+// Color::parse maps it back to the same float; otherwise the double
+// product, which is exact and always reads back bit-identical.
+void appendChannel(std::string& out, float channel, float scale) {
+    char buf[32];
+    auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), channel * scale);
+    if (ec == std::errc()) {
+        double value = 0;
+        auto [end, readEc] = std::from_chars(buf, ptr, value);
+        if (readEc == std::errc() && end == ptr && static_cast<float>(value / scale) == channel) {
+            out.append(buf, ptr);
+            return;
+        }
+    }
+    appendNumber(out, static_cast<double>(channel) * scale);
+}
+
+void appendColor(std::string& out, const Color& color) {
+    out += "\"rgba(";
+    appendChannel(out, color.r, 255.0f);
+    out += ", ";
+    appendChannel(out, color.g, 255.0f);
+    out += ", ";
+    appendChannel(out, color.b, 255.0f);
+    out += ", ";
+    appendChannel(out, color.a, 1.0f);
+    out += ")\"";
+}
+
+void appendKey(std::string& out, std::string_view key) {
+    out += key;
+    out += " = ";
+}
+
+void appendString(std::string& out, std::string_view key, std::string_view value) {
+    appendKey(out, key);
+    out += '"';
+    out += value;
+    out += "\"\n";
+}
+
+void appendInt(std::string& out, std::string_view key, long long value) {
+    appendKey(out, key);
+    appendNumber(out, value);
+    out += '\n';
+}
+
+void appendBool(std::string& out, std::string_view key, bool value) {
+    appendKey(out, key);
+    out += value ? "true\n" : "false\n";
+}
+
+}  // namespace
+
+std::string serializeConfig(const Config& config) {
+    size_t zoneCount = 0;
+    for (const auto& layout : config.layouts) {
+        zoneCount += layout.zones.size();
+    }
+
+    std::string out;
+    out.reserve(512 + config.layouts.size() * 96 + zoneCount * 96 + config.mappings.size() * 80 +
+                config.monitorOverrides.size() * 96);
+
+    out += "[general]\n";
+    appendString(out, "snap_modifier", config.snapModifier);
+    appendBool(out, "show_on_drag", config.showOnDrag);
+    appendBool(out, "require_modifier", config.requireModifier);
+    appendBool(out, "show_zone_numbers", config.showZoneNumbers);
+    appendBool(out, "show_zone_names", config.showZoneNames);
+    for (auto [key, color] : {std::pair{"zone_highlight_color", &config.highlightColor},
+                              std::pair{"zone_border_color", &config.borderColor},
+                              std::pair{"zone_inactive_color", &config.inactiveColor},
+                              std::pair{"zone_number_color", &config.numberColor}}) {
+        appendKey(out, key);
+        appendColor(out, *color);
+        out += '\n';
+    }
+    appendInt(out, "zone_border_width", config.borderWidth);
+    appendBool(out, "move_to_last_known_zone", config.moveToLastKnownZone);
+    appendBool(out, "restore_size_on_unsnap", config.restoreSizeOnUnsnap);
+    appendBool(out, "allow_multi_zone", config.allowMultiZone);
+    appendBool(out, "flash_on_layout_change", config.flashOnLayoutChange);
+    appendInt(out, "sensitivity_radius", config.sensitivityRadius);
+    out += '\n';
+
+    for (const auto& layout : config.layouts) {
+        out += "[[layouts]]\n";
+        appendString(out, "name", layout.name);
+        appendInt(out, "spacing_h", layout.spacingH);
+        appendInt(out, "spacing_v", layout.spacingV);
+        if (!layout.hotkey.empty()) {
+            appendString(out, "hotkey", layout.hotkey);
+        }
+        if (!layout.templateType.empty()) {
+            appendString(out, "template", layout.templateType);
+            if (layout.columns > 0)
+                appendInt(out, "columns", layout.columns);
+            if (layout.rows > 0)
+                appendInt(out, "rows", layout.rows);
+        }
+
+        for (const auto& zone : layout.zones) {
+            out += "\n[[layouts.zones]]\n";
+            appendString(out, "name", zone.name);
+            for (auto [key, value] : {std::pair{"x", zone.x}, std::pair{"y", zone.y},
+                                      std::pair{"width", zone.width}, std::pair{"height", zone.height}}) {
+                appendKey(out, key);
+                appendPercent(out, value);
+                out += '\n';
+            }
+        }
+        out += '\n';
+    }
+
+    if (!config.mappings.empty()) {
+        out += "# Monitor/Workspace to Layout mappings\n";
+        for (const auto& mapping : config.mappings) {
+            out += "[[mappings]]\n";
+            appendString(out, "monitor", mapping.monitor);
+            appendString(out, "workspaces", mapping.workspaces);
+            appendString(out, "layout", mapping.layout);
+            out += '\n';
+        }
+    }
+
+    if (!config.monitorOverrides.empty()) {
+        out += "# Reserved edges per monitor (unset edges follow the compositor)\n";
+        for (const auto& monitor : config.monitorOverrides) {
+            out += "[[monitors]]\n";
+            appendString(out, "monitor", monitor.monitor);
+            for (auto [key, value] : {std::pair{"reserved_top", monitor.reservedTop},
+                                      std::pair{"reserved_bottom", monitor.reservedBottom},
+                                      std::pair{"reserved_left", monitor.reservedLeft},
+                                      std::pair{"reserved_right", monitor.reservedRight}}) {
+                if (value >= 0)
+                    appendInt(out, key, value);
+            }
+            out += '\n';
+        }
+    }
+
+    return out;
+}
+
+}  // namespace HyprZones
@@ -0,0 +1,101 @@
+#include "hyprzones/DamageRegion.hpp"
+#include <algorithm>
+
+namespace HyprZones {
+
+static bool covers(const GeometryBox& outer, const GeometryBox& inner) {
+    return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.w <= outer.x + outer.w &&
+           inner.y + inner.h <= outer.y + outer.h;
+}
+
+static GeometryBox boundingBox(const GeometryBox& a, const GeometryBox& b) {
+    double x0 = std::min(a.x, b.x);
+    double y0 = std::min(a.y, b.y);
+    double x1 = std::max(a.x + a.w, b.x + b.w);
+    double y1 = std::max(a.y + a.h, b.y + b.h);
+    return {x0, y0, x1 - x0, y1 - y0};
+}
+
+void DamageRegion::add(const GeometryBox& box) {
+    if (box.w <= 0 || box.h <= 0) {
+        return;
+    }
+    for (size_t i = 0; i < m_count; ++i) {
+        if (covers(m_boxes[i], box)) {
+            return;
+        }
+    }
+
+    // Drop boxes the new one covers
+    size_t kept = 0;
+    for (size_t i = 0; i < m_count; ++i) {
+        if (!covers(box, m_boxes[i])) {
+            m_boxes[kept++] = m_boxes[i];
+        }
+    }
+    m_count = kept;
+
+    if (m_count == MAX_BOXES) {
+        m_boxes[0] = boundingBox(bounds(), box);
+        m_count    = 1;
+        return;
+    }
+    m_boxes[m_count++] = box;
+}
+
+GeometryBox DamageRegion::bounds() const {
+    if (m_count == 0) {
+        return {};
+    }
+    GeometryBox result = m_boxes[0];
+    for (size_t i = 1; i < m_count; ++i) {
+        result = boundingBox(result, m_boxes[i]);
+    }
+    return result;
+}
+
+bool DamageRegion::contains(double x, double y) const {
+    for (size_t i = 0; i < m_count; ++i) {
+        const auto& b = m_boxes[i];
+        if (x >= b.x && x < b.x + b.w && y >= b.y && y < b.y + b.h) {
+            return true;
+        }
+    }
+    return false;
+}
+
+double DamageRegion::area() const {
+    double sum = 0;
+    for (size_t i = 0; i < m_count; ++i) {
+        sum += m_boxes[i].w * m_boxes[i].h;
+    }
+    return sum;
+}
+
+void addHighlightDamage(DamageRegion& out, const ResolvedLayout& resolved, const ZoneSelection& before,
+                        const ZoneSelection& after, int borderWidth) {
+    const auto& zones   = resolved.layout.zones;
+    const auto& monitor = resolved.key.monitor;
+    double      grow    = borderWidth + 1.0;
+
+    auto addZone = [&](int index) {
+        if (index < 0 || static_cast<size_t>(index) >= zones.size()) {
+            return;
+        }
+        const Zone& zone = zones[index];
+        double      x0   = std::max(zone.pixelX - grow, monitor.x);
+        double      y0   = std::max(zone.pixelY - grow, monitor.y);
+        double      x1   = std::min(zone.pixelX + zone.pixelW + grow, monitor.x + monitor.width);
+        double      y1   = std::min(zone.pixelY + zone.pixelH + grow, monitor.y + monitor.height);
+        out.add({x0, y0, x1 - x0, y1 - y0});
+    };
+
+    before.forEach(addZone);
+    after.forEach([&](int index) {
+        if (!before.contains(index)) {
+            addZone(index);
+        }
+    });
+}
+
+}  // namespace HyprZones
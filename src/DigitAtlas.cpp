@@ -0,0 +1,42 @@
+#include "hyprzones/DigitAtlas.hpp"
+
+namespace HyprZones {
+
+DigitAtlasMetrics DigitAtlasMetrics::forScale(float scale) {
+    DigitAtlasMetrics metrics;
+    metrics.fontSize  = static_cast<int>(24 * scale);
+    metrics.padding   = static_cast<int>(8 * scale);
+    metrics.badgeSize = metrics.fontSize + metrics.padding * 2;
+    metrics.height    = metrics.badgeSize;
+    return metrics;
+}
+
+size_t composeBadge(const DigitAtlasMetrics& metrics, int number, double cx, double cy, BadgeQuads& out) {
+    // Digits most significant first, without allocating
+    int  digits[MAX_BADGE_DIGITS];
+    int  count = 0;
+    auto value = static_cast<unsigned>(number < 0 ? 0 : number);
+    do {
+        digits[count++] = static_cast<int>(value % 10);
+        value /= 10;
+    } while (value && count < MAX_BADGE_DIGITS);
+
+    double top = cy - metrics.height / 2.0;
+    out[0]     = {metrics.badge(), {cx - metrics.badgeSize / 2.0, top, double(metrics.badgeSize), double(metrics.height)}};
+
+    // Narrow the digits if the number is wider than the circle's text area
+    double digitW = metrics.digitWidth;
+    double room   = metrics.badgeSize - metrics.padding;
+    if (digitW * count > room && count > 0) {
+        digitW = room / count;
+    }
+
+    double x = cx - digitW * count / 2.0;
+    for (int i = 0; i < count; ++i) {
+        out[1 + i] = {metrics.digit(digits[count - 1 - i]), {x, top, digitW, double(metrics.height)}};
+        x += digitW;
+    }
+    return 1 + static_cast<size_t>(count);
+}
+
+}  // namespace HyprZones
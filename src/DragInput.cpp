@@ -0,0 +1,171 @@
+#include "hyprzones/DragInput.hpp"
+#include "hyprzones/Config.hpp"
+#include "hyprzones/Trace.hpp"
+#include "hyprzones/ZoneManager.hpp"
+#include <linux/input-event-codes.h>
+
+namespace HyprZones {
+
+uint32_t modifierMaskFromName(const std::string& name) {
+    if (name == "SHIFT")
+        return MOD_SHIFT;
+    if (name == "CTRL" || name == "CONTROL")
+        return MOD_CTRL;
+    if (name == "ALT")
+        return MOD_ALT;
+    if (name == "SUPER" || name == "META")
+        return MOD_META;
+    return 0;
+}
+
+void DragInput::motion(double x, double y, uint32_t mods, void* draggedWindow,
+                       const std::shared_ptr<const Config>& config) {
+    if (m_recorder) {
+        m_recorder->motion(x, y, mods, draggedWindow, *config);
+    }
+
+    if (!draggedWindow) {
+        // No window being dragged - the drag ended where the compositor left it
+        if (m_session.isDragging) {
+            m_host.releaseWindow(m_session.draggedWindow);
+            end();
+        }
+        return;
+    }
+
+    // New drag: pin the config snapshot, resolve monitor, layout and modifier mask once
+    if (!m_session.isDragging || m_session.draggedWindow != draggedWindow) {
+        m_session.reset();
+        m_session.isDragging       = true;
+        m_session.draggedWindow    = draggedWindow;
+        m_session.config           = config;
+        m_session.snapModifierMask = modifierMaskFromName(config->snapModifier);
+        m_session.dragStartX       = x;
+        m_session.dragStartY       = y;
+        bindMonitor(m_host.monitorAt(x, y));
+    }
+
+    // Check modifier key for zone snapping
+    const Config& pinned         = *m_session.config;
+    bool          modifierHeld   = (mods & m_session.snapModifierMask) != 0;
+    bool          shouldActivate = pinned.showOnDrag && (!pinned.requireModifier || modifierHeld);
+
+    if (!shouldActivate) {
+        if (m_session.isZoneSnapping) {
+            m_session.stopSnapping();
+            m_host.hideOverlay();
+            if (m_session.currentMonitor) {
+                m_host.damage(m_session.currentMonitor);
+            }
+        }
+        return;
+    }
+
+    // Cursor crossed onto another monitor: re-resolve that monitor's layout
+    bool redrawAll = false;
+    if (!m_session.onCurrentMonitor(x, y)) {
+        void* monitor = m_host.monitorAt(x, y);
+        if (monitor && monitor != m_session.currentMonitor) {
+            if (m_session.currentMonitor) {
+                m_host.damage(m_session.currentMonitor);
+            }
+            bindMonitor(monitor);
+            redrawAll = true;
+        }
+    }
+
+    // Start zone snapping
+    if (!m_session.isZoneSnapping) {
+        m_session.isZoneSnapping = true;
+        m_session.ctrlHeld       = (mods & MOD_CTRL) != 0;
+        m_host.showOverlay();
+        redrawAll = true;
+    }
+
+    ZoneSelection before  = m_session.selectedZones;
+    bool          changed = m_session.updateCursor(m_zoneManager, x, y);
+    if (!m_session.currentMonitor) {
+        return;
+    }
+
+    // Overlay just appeared, or the selection belongs to another layout now
+    if (redrawAll) {
+        m_host.damage(m_session.currentMonitor);
+        return;
+    }
+
+    // Zone changed: redraw only the zones whose highlight may have changed
+    if (changed && m_session.layout) {
+        m_damage.clear();
+        addHighlightDamage(m_damage, *m_session.layout, before, m_session.selectedZones, pinned.borderWidth);
+        if (!m_damage.empty()) {
+            m_host.damageRegion(m_session.currentMonitor, m_damage);
+        }
+    }
+}
+
+void DragInput::button(uint32_t button, bool pressed) {
+    if (m_recorder) {
+        m_recorder->button(button, pressed);
+    }
+
+    // Only a left button release ends a drag
+    if (button != BTN_LEFT || pressed) {
+        return;
+    }
+
+    bool snapped = false;
+    if (m_session.isDragging && m_session.isZoneSnapping) {
+        snapped = drop();
+        // Final damage clears the highlight
+        if (m_session.currentMonitor) {
+            m_host.damage(m_session.currentMonitor);
+        }
+    }
+    if (m_session.isDragging && !snapped) {
+        m_host.releaseWindow(m_session.draggedWindow);
+    }
+    end();
+}
+
+void DragInput::cancel() {
+    if (m_session.isDragging) {
+        end();
+    }
+}
+
+void DragInput::bindMonitor(void* monitor) {
+    auto resolved = monitor ? m_host.resolveLayout(monitor, *m_session.config) : nullptr;
+    if (m_recorder) {
+        m_recorder->monitorBound(monitor, resolved.get());
+    }
+    m_session.setMonitor(monitor, std::move(resolved));
+}
+
+// Snap the dragged window onto the selection; false if there was nothing to snap to
+bool DragInput::drop() {
+    if (m_session.selectedZones.empty() || !m_session.draggedWindow || !m_session.layout) {
+        return false;
+    }
+
+    const Layout& layout = m_session.layout->layout;
+    GeometryBox   box;
+    m_zoneManager.getCombinedZoneBox(layout, m_session.selectedZones, box.x, box.y, box.w, box.h);
+    if (box.w <= 0 || box.h <= 0) {
+        return false;
+    }
+
+    m_host.snapWindow(m_session.draggedWindow, layout.name, m_session.selectedZones, box);
+    if (m_recorder) {
+        m_recorder->snapped(m_session.draggedWindow, layout.name, m_session.selectedZones, box);
+    }
+    return true;
+}
+
+// End the drag session and hide the overlay unless manually opened
+void DragInput::end() {
+    m_session.reset();
+    m_host.hideOverlay();
+}
+
+}  // namespace HyprZones
@@ -0,0 +1,77 @@
+#include "hyprzones/DragSession.hpp"
+#include "hyprzones/Config.hpp"
+#include "hyprzones/ZoneManager.hpp"
+
+namespace HyprZones {
+
+void DragSession::setMonitor(void* monitor, std::shared_ptr<const ResolvedLayout> resolved) {
+    currentMonitor = monitor;
+    layout         = std::move(resolved);
+    startZone      = -1;
+    currentZone    = -1;
+    selectedZones.clear();
+}
+
+void DragSession::stopSnapping() {
+    isZoneSnapping = false;
+    ctrlHeld       = false;
+    startZone      = -1;
+    currentZone    = -1;
+    selectedZones.clear();
+}
+
+int DragSession::zoneAt(ZoneManager& zoneManager, double px, double py) const {
+    if (!layout)
+        return -1;
+
+    const auto& zones  = layout->layout.zones;
+    double      radius = config ? config->sensitivityRadius : 0;
+    int         zone   = zoneManager.getSmallestZoneAtPoint(layout->layout, px, py);
+    if (radius <= 0 || (zone >= 0 && zone == currentZone))
+        return zone;
+
+    // Dead band: leaving the current zone (not entering a zone nested in it)
+    // takes `radius` pixels past its edge, so a cursor resting on a shared
+    // edge or a gap doesn't flip the highlight back and forth
+    if (currentZone >= 0 && static_cast<size_t>(currentZone) < zones.size()) {
+        const Zone& current = zones[currentZone];
+        if (!current.containsPoint(px, py) && current.distanceTo(px, py) <= radius)
+            return currentZone;
+    }
+
+    // In a gap or margin: the nearest zone, if it is close enough
+    if (zone < 0)
+        zone = zoneManager.getNearestZone(layout->layout, px, py, radius);
+    return zone;
+}
+
+bool DragSession::updateCursor(ZoneManager& zoneManager, double px, double py) {
+    currentX = px;
+    currentY = py;
+
+    int zone = zoneAt(zoneManager, px, py);
+
+    // Only update if zone changed
+    if (zone == currentZone) {
+        return false;
+    }
+
+    currentZone = zone;
+
+    if (zone >= 0) {
+        if (ctrlHeld && startZone >= 0) {
+            zoneManager.getZoneRange(*layout, startZone, zone, selectedZones);
+        } else {
+            selectedZones.set(zone);
+            if (startZone < 0) {
+                startZone = zone;
+            }
+        }
+    } else {
+        selectedZones.clear();
+    }
+
+    return true;
+}
+
+}  // namespace HyprZones
@@ -4,37 +4,59 @@
 
 #include "hyprzones/Globals.hpp"
 #include "hyprzones/Config.hpp"
-#include "hyprzones/DragState.hpp"
+#include "hyprzones/ConfigWatcher.hpp"
+#include "hyprzones/ConfigSaver.hpp"
+#include "hyprzones/DragSession.hpp"
 #include "hyprzones/ZoneManager.hpp"
 #include "hyprzones/LayoutManager.hpp"
+#include "hyprzones/MonitorTracker.hpp"
 #include "hyprzones/WindowSnapper.hpp"
+#include "hyprzones/WindowRegistry.hpp"
+#include "hyprzones/HyprlandGeometryBackend.hpp"
 #include "hyprzones/Renderer.hpp"
 
 namespace HyprZones {
 
 HANDLE g_handle = nullptr;
 
-std::unique_ptr<ZoneManager>   g_zoneManager;
-std::unique_ptr<LayoutManager> g_layoutManager;
-std::unique_ptr<WindowSnapper> g_windowSnapper;
-std::unique_ptr<Renderer>      g_renderer;
-Config                         g_config;
-DragState                      g_dragState;
+std::unique_ptr<ZoneManager>           g_zoneManager;
+std::unique_ptr<LayoutManager>         g_layoutManager;
+std::unique_ptr<MonitorTracker>        g_monitorTracker;
+std::unique_ptr<WindowSnapper>         g_windowSnapper;
+std::unique_ptr<WindowRegistry>        g_windowRegistry;
+std::unique_ptr<WindowGeometryBackend> g_geometryBackend;
+std::unique_ptr<Renderer>              g_renderer;
+std::unique_ptr<ConfigWatcher>         g_configWatcher;
+std::unique_ptr<ConfigSaver>           g_configSaver;
+std::shared_ptr<const Config>          g_config;
+DragSession                            g_dragSession;
 
 void initGlobals() {
-    g_zoneManager   = std::make_unique<ZoneManager>();
-    g_layoutManager = std::make_unique<LayoutManager>();
-    g_windowSnapper = std::make_unique<WindowSnapper>();
-    g_renderer      = std::make_unique<Renderer>();
-    g_config        = Config{};
-    g_dragState.reset();
+    g_zoneManager     = std::make_unique<ZoneManager>();
+    g_layoutManager   = std::make_unique<LayoutManager>();
+    g_monitorTracker  = std::make_unique<MonitorTracker>();
+    g_windowSnapper   = std::make_unique<WindowSnapper>(*g_zoneManager);
+    g_windowRegistry  = std::make_unique<WindowRegistry>();
+    g_geometryBackend = std::make_unique<HyprlandGeometryBackend>();
+    g_renderer        = std::make_unique<Renderer>();
+    g_configWatcher   = std::make_unique<ConfigWatcher>();
+    g_configSaver     = std::make_unique<ConfigSaver>();
+    g_config          = std::make_shared<const Config>();
+    g_dragSession.reset();
 }
 
 void cleanupGlobals() {
+    g_configWatcher.reset();  // joins the worker before anything it touches goes away
+    g_configSaver.reset();    // finishes queued saves
     g_zoneManager.reset();
     g_layoutManager.reset();
+    g_monitorTracker.reset();
     g_windowSnapper.reset();
+    g_windowRegistry.reset();
+    g_geometryBackend.reset();
     g_renderer.reset();
+    g_dragSession.reset();
+    g_config.reset();
 }
 
 }  // namespace HyprZones
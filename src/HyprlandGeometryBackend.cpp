@@ -0,0 +1,48 @@
+#define WLR_USE_UNSTABLE
+
+#include "hyprzones/HyprlandGeometryBackend.hpp"
+#include "hyprzones/Globals.hpp"
+#include "hyprzones/WindowRegistry.hpp"
+
+#include <hyprland/src/Compositor.hpp>
+#include <hyprland/src/desktop/view/Window.hpp>
+#include <hyprland/src/managers/KeybindManager.hpp>
+
+#include <cstdio>
+#include <cstdint>
+#include <string>
+
+namespace HyprZones {
+
+bool HyprlandGeometryBackend::apply(void* windowPtr, const GeometryBox& box) {
+    // Only live windows: the address may belong to one that closed meanwhile
+    PHLWINDOW window = g_windowRegistry ? g_windowRegistry->get(windowPtr) : nullptr;
+    if (!window) {
+        return false;
+    }
+
+    static const std::string RESIZE = "resizewindowpixel";
+    static const std::string MOVE   = "movewindowpixel";
+
+    auto& dispatchers = g_pKeybindManager->m_dispatchers;
+    auto  resizeIt    = dispatchers.find(RESIZE);
+    auto  moveIt      = dispatchers.find(MOVE);
+    if (resizeIt == dispatchers.end() || moveIt == dispatchers.end()) {
+        return false;
+    }
+
+    auto addr = reinterpret_cast<uintptr_t>(windowPtr);
+    char moveArg[96];
+    char sizeArg[96];
+    std::snprintf(moveArg, sizeof(moveArg), "exact %d %d,address:0x%lx",
+                  static_cast<int>(box.x), static_cast<int>(box.y), static_cast<unsigned long>(addr));
+    std::snprintf(sizeArg, sizeof(sizeArg), "exact %d %d,address:0x%lx",
+                  static_cast<int>(box.w), static_cast<int>(box.h), static_cast<unsigned long>(addr));
+
+    // Resize first, then move (Hyprland 0.54+ requires this order)
+    resizeIt->second(sizeArg);
+    moveIt->second(moveArg);
+    return true;
+}
+
+}  // namespace HyprZones
@@ -0,0 +1,96 @@
+#include "hyprzones/LabelCache.hpp"
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace HyprZones {
+
+size_t LabelKeyHash::operator()(const LabelKeyView& key) const {
+    size_t h = std::hash<std::string_view>{}(key.text);
+    h ^= (static_cast<size_t>(key.color) << 16 ^ static_cast<size_t>(key.scaleKey)) + 0x9e3779b97f4a7c15ULL +
+         (h << 6) + (h >> 2);
+    return h;
+}
+
+bool LabelWorker::start() {
+    stop();
+
+    m_readyFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_readyFd < 0) {
+        return false;
+    }
+
+    m_stopping = false;
+    m_worker   = std::thread([this] { run(); });
+    return true;
+}
+
+void LabelWorker::stop() {
+    if (m_worker.joinable()) {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+            m_queue.clear();  // labels are cheap to ask for again
+        }
+        m_wake.notify_one();
+        m_worker.join();
+    }
+
+    if (m_readyFd >= 0) {
+        close(m_readyFd);
+        m_readyFd = -1;
+    }
+
+    std::lock_guard lock(m_mutex);
+    m_queue.clear();
+    m_results.clear();
+}
+
+bool LabelWorker::request(LabelKey key) {
+    if (!m_worker.joinable()) {
+        return false;
+    }
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_queue.size() >= MAX_QUEUED) {
+            return false;
+        }
+        m_queue.push_back(std::move(key));
+    }
+    m_wake.notify_one();
+    return true;
+}
+
+std::vector<std::pair<LabelKey, LabelBitmap>> LabelWorker::takeResults() {
+    uint64_t count;
+    (void)!read(m_readyFd, &count, sizeof(count));
+
+    std::lock_guard lock(m_mutex);
+    return std::move(m_results);
+}
+
+void LabelWorker::run() {
+    while (true) {
+        LabelKey key;
+        {
+            std::unique_lock lock(m_mutex);
+            m_wake.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+            if (m_stopping) {
+                return;
+            }
+            key = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        LabelBitmap bitmap = m_rasterizer(key);
+
+        {
+            std::lock_guard lock(m_mutex);
+            m_results.emplace_back(std::move(key), std::move(bitmap));
+        }
+
+        uint64_t one = 1;
+        (void)!write(m_readyFd, &one, sizeof(one));
+    }
+}
+
+}  // namespace HyprZones
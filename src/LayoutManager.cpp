@@ -1,11 +1,11 @@
 #include "hyprzones/LayoutManager.hpp"
-#include <fstream>
-
-// Debug log to file
-static void logToFile(const std::string& msg) {
-    std::ofstream f("/tmp/hyprzones.log", std::ios::app);
-    if (f) f << msg << "\n";
-}
+#include "hyprzones/Log.hpp"
+#include "hyprzones/Stats.hpp"
+#include "hyprzones/ZoneSelection.hpp"
+#include <algorithm>
+#include <charconv>
+#include <limits>
+#include <tuple>
 
 namespace HyprZones {
 
@@ -89,6 +89,13 @@ Layout LayoutManager::generateFromTemplate(const std::string& templateType,
         layout.zones.push_back(bottom);
     }
 
+    // Same cap as config loading: selections cannot address more zones
+    if (layout.zones.size() > static_cast<size_t>(ZoneSelection::CAPACITY)) {
+        HZ_LOG_WARN("Template %s: %zu zones cut to %d", templateType.c_str(), layout.zones.size(),
+                    ZoneSelection::CAPACITY);
+        layout.zones.resize(ZoneSelection::CAPACITY);
+    }
+
     return layout;
 }
 
@@ -97,299 +104,253 @@ static int normalizeWs(int ws) {
     return ws == 0 ? 10 : ws;
 }
 
-bool LayoutManager::workspaceMatchesPattern(int workspace, const std::string& pattern) {
-    if (pattern.empty() || pattern == "*") {
-        return true;
-    }
+bool LayoutManager::parseWorkspacePattern(std::string_view pattern,
+                                          std::vector<std::pair<int, int>>& outRanges) {
+    outRanges.clear();
 
-    // Handle comma-separated values: "1,3,5"
-    if (pattern.find(',') != std::string::npos) {
-        std::string p = pattern;
-        size_t pos = 0;
-        while ((pos = p.find(',')) != std::string::npos) {
-            std::string token = p.substr(0, pos);
-            if (!token.empty() && normalizeWs(std::stoi(token)) == workspace) {
-                return true;
-            }
-            p.erase(0, pos + 1);
-        }
-        if (!p.empty() && normalizeWs(std::stoi(p)) == workspace) {
-            return true;
-        }
-        return false;
-    }
+    auto trimView = [](std::string_view v) {
+        while (!v.empty() && (v.front() == ' ' || v.front() == '\t')) v.remove_prefix(1);
+        while (!v.empty() && (v.back() == ' ' || v.back() == '\t')) v.remove_suffix(1);
+        return v;
+    };
+
+    auto parseInt = [](std::string_view v, int& out) {
+        auto [ptr, ec] = std::from_chars(v.data(), v.data() + v.size(), out);
+        return ec == std::errc() && ptr == v.data() + v.size();
+    };
 
-    // Handle range: "1-5"
-    if (pattern.find('-') != std::string::npos) {
-        size_t dashPos = pattern.find('-');
-        int start = normalizeWs(std::stoi(pattern.substr(0, dashPos)));
-        int end = normalizeWs(std::stoi(pattern.substr(dashPos + 1)));
-        return workspace >= start && workspace <= end;
+    pattern = trimView(pattern);
+    if (pattern.empty() || pattern == "*") {
+        return true;  // any workspace
     }
 
-    // Single number
-    return normalizeWs(std::stoi(pattern)) == workspace;
-}
+    // Comma-separated tokens, each a single number or a range: "1,3,5-7"
+    while (!pattern.empty()) {
+        size_t      comma = pattern.find(',');
+        std::string_view token = trimView(pattern.substr(0, comma));
+        pattern = comma == std::string_view::npos ? std::string_view{} : pattern.substr(comma + 1);
 
-Layout* LayoutManager::getLayoutForMonitor(Config& config,
-                                           const std::string& monitorName,
-                                           int workspace) {
-    // Check mappings first (most specific match wins)
-    for (const auto& mapping : config.mappings) {
-        bool monitorMatch = mapping.monitor == "*" || mapping.monitor == monitorName;
-        bool wsMatch = workspaceMatchesPattern(workspace, mapping.workspaces);
+        if (token.empty()) {
+            continue;
+        }
 
-        if (monitorMatch && wsMatch) {
-            auto it = config.layoutIndex.find(mapping.layout);
-            if (it != config.layoutIndex.end() && it->second < config.layouts.size()) {
-                return &config.layouts[it->second];
+        int    start = 0;
+        int    end   = 0;
+        size_t dash  = token.find('-', 1);
+        if (dash != std::string_view::npos) {
+            if (!parseInt(trimView(token.substr(0, dash)), start) ||
+                !parseInt(trimView(token.substr(dash + 1)), end)) {
+                return false;
+            }
+        } else {
+            if (!parseInt(token, start)) {
+                return false;
             }
+            end = start;
         }
-    }
 
-    // Fall back to active layout
-    if (!config.activeLayout.empty()) {
-        auto it = config.layoutIndex.find(config.activeLayout);
-        if (it != config.layoutIndex.end() && it->second < config.layouts.size()) {
-            return &config.layouts[it->second];
+        start = normalizeWs(start);
+        end   = normalizeWs(end);
+        if (start > end) {
+            std::swap(start, end);
         }
+        outRanges.emplace_back(start, end);
     }
 
-    // Last resort: first layout
-    if (!config.layouts.empty()) {
-        return &config.layouts[0];
+    if (outRanges.empty()) {
+        return false;
     }
 
-    return nullptr;
-}
-
-void LayoutManager::switchLayout(Config& config, const std::string& layoutName) {
-    auto it = config.layoutIndex.find(layoutName);
-    if (it != config.layoutIndex.end()) {
-        config.activeLayout = layoutName;
+    // Sort and merge overlapping/adjacent ranges
+    std::sort(outRanges.begin(), outRanges.end());
+    size_t merged = 0;
+    for (size_t i = 1; i < outRanges.size(); ++i) {
+        if (outRanges[i].first <= outRanges[merged].second + 1) {
+            outRanges[merged].second = std::max(outRanges[merged].second, outRanges[i].second);
+        } else {
+            outRanges[++merged] = outRanges[i];
+        }
     }
+    outRanges.resize(merged + 1);
+    return true;
 }
 
-void LayoutManager::cycleLayout(Config& config, int direction) {
-    if (config.layouts.empty()) {
-        return;
+bool CompiledMapping::matches(const std::string& monitorName, int workspace) const {
+    if (!monitor.empty() && monitor != monitorName) {
+        return false;
     }
-
-    auto it = config.layoutIndex.find(config.activeLayout);
-    size_t currentIdx = (it != config.layoutIndex.end()) ? it->second : 0;
-
-    int newIdx = static_cast<int>(currentIdx) + direction;
-    int count  = static_cast<int>(config.layouts.size());
-
-    newIdx = ((newIdx % count) + count) % count;
-
-    config.activeLayout = config.layouts[newIdx].name;
+    if (workspaces.empty()) {
+        return true;
+    }
+    for (const auto& [start, end] : workspaces) {
+        if (workspace < start) {
+            return false;  // ranges are sorted
+        }
+        if (workspace <= end) {
+            return true;
+        }
+    }
+    return false;
 }
 
-bool LayoutManager::saveLayouts(const std::string& path, const std::vector<Layout>& layouts,
-                                 const std::vector<LayoutMapping>& mappings) {
-    std::ofstream file(path);
-    if (!file.is_open()) {
-        return false;
-    }
+void LayoutManager::compileMappings(Config& config) {
+    config.mappingsGeneration = nextConfigGeneration();
+    config.compiledMappings.clear();
+    config.compiledMappings.reserve(config.mappings.size());
 
-    // Write layouts
-    for (const auto& layout : layouts) {
-        file << "[[layouts]]\n";
-        file << "name = \"" << layout.name << "\"\n";
-        file << "spacing_h = " << layout.spacingH << "\n";
-        file << "spacing_v = " << layout.spacingV << "\n";
+    for (size_t i = 0; i < config.mappings.size(); ++i) {
+        const auto& mapping = config.mappings[i];
 
-        if (!layout.hotkey.empty()) {
-            file << "hotkey = \"" << layout.hotkey << "\"\n";
-        }
-        if (!layout.templateType.empty()) {
-            file << "template = \"" << layout.templateType << "\"\n";
-            if (layout.columns > 0) file << "columns = " << layout.columns << "\n";
-            if (layout.rows > 0) file << "rows = " << layout.rows << "\n";
+        auto it = config.layoutIndex.find(mapping.layout);
+        if (it == config.layoutIndex.end() || it->second >= config.layouts.size()) {
+            HZ_LOG_WARN("Mapping skipped, unknown layout: %s", mapping.layout.c_str());
+            continue;
         }
 
-        for (const auto& zone : layout.zones) {
-            file << "\n[[layouts.zones]]\n";
-            file << "name = \"" << zone.name << "\"\n";
-            file << "x = " << static_cast<int>(zone.x * 100) << "\n";
-            file << "y = " << static_cast<int>(zone.y * 100) << "\n";
-            file << "width = " << static_cast<int>(zone.width * 100) << "\n";
-            file << "height = " << static_cast<int>(zone.height * 100) << "\n";
+        // Only an explicit "*" means any monitor
+        if (mapping.monitor.empty()) {
+            HZ_LOG_WARN("Mapping skipped, no monitor: layout %s", mapping.layout.c_str());
+            continue;
         }
 
-        file << "\n";
-    }
+        CompiledMapping compiled;
+        compiled.monitor   = mapping.monitor == "*" ? "" : mapping.monitor;
+        compiled.layoutIdx = it->second;
+        compiled.order     = i;
 
-    // Write mappings
-    if (!mappings.empty()) {
-        file << "# Monitor/Workspace to Layout mappings\n";
-        for (const auto& mapping : mappings) {
-            file << "[[mappings]]\n";
-            file << "monitor = \"" << mapping.monitor << "\"\n";
-            file << "workspaces = \"" << mapping.workspaces << "\"\n";
-            file << "layout = \"" << mapping.layout << "\"\n";
-            file << "\n";
+        if (!parseWorkspacePattern(mapping.workspaces, compiled.workspaces)) {
+            HZ_LOG_WARN("Mapping skipped, invalid workspaces: %s", mapping.workspaces.c_str());
+            continue;
         }
-    }
 
-    return true;
-}
+        if (compiled.workspaces.empty()) {
+            compiled.workspaceCount = std::numeric_limits<long long>::max();
+        } else {
+            for (const auto& [start, end] : compiled.workspaces) {
+                compiled.workspaceCount += static_cast<long long>(end) - start + 1;
+            }
+        }
 
-std::vector<Layout> LayoutManager::loadLayouts(const std::string& path) {
-    std::vector<Layout> layouts;
-    std::ifstream file(path);
-    if (!file.is_open()) {
-        return layouts;
+        config.compiledMappings.push_back(std::move(compiled));
     }
 
-    std::string line;
-    Layout currentLayout;
-    Zone currentZone;
-    bool inLayout = false;
-    bool inZone = false;
-
-    auto trim = [](std::string& s) {
-        s.erase(0, s.find_first_not_of(" \t\r\n"));
-        s.erase(s.find_last_not_of(" \t\r\n") + 1);
-    };
+    // Most specific first: explicit workspaces, then explicit monitor,
+    // then fewer workspaces, then file order
+    std::stable_sort(config.compiledMappings.begin(), config.compiledMappings.end(),
+                     [](const CompiledMapping& a, const CompiledMapping& b) {
+        return std::make_tuple(a.workspaces.empty(), a.monitor.empty(), a.workspaceCount, a.order) <
+               std::make_tuple(b.workspaces.empty(), b.monitor.empty(), b.workspaceCount, b.order);
+    });
+}
 
-    auto parseString = [](const std::string& value) -> std::string {
-        std::string result = value;
-        if (result.front() == '"') result.erase(0, 1);
-        if (result.back() == '"') result.pop_back();
-        return result;
-    };
+void LayoutManager::invalidateMappingCache() {
+    m_mappingMemo.clear();
+    m_memoGeneration = 0;
+}
 
-    while (std::getline(file, line)) {
-        trim(line);
-        if (line.empty() || line[0] == '#') continue;
+const Layout* LayoutManager::getLayoutForMonitor(const Config& config,
+                                                 const std::string& monitorName,
+                                                 int workspace) {
+    // Entries hold layout indices: only valid for the mappings that filled them
+    if (m_memoGeneration != config.mappingsGeneration) {
+        m_mappingMemo.clear();
+        m_memoGeneration = config.mappingsGeneration;
+    }
 
-        if (line == "[[layouts]]") {
-            if (inLayout && !currentLayout.name.empty()) {
-                if (inZone && !currentZone.name.empty()) {
-                    currentLayout.zones.push_back(currentZone);
-                }
-                layouts.push_back(currentLayout);
+    // A per-monitor switch beats the mappings
+    if (!m_monitorLayouts.empty()) {
+        auto switched = m_monitorLayouts.find(monitorName);
+        if (switched != m_monitorLayouts.end()) {
+            auto it = config.layoutIndex.find(switched->second);
+            if (it != config.layoutIndex.end() && it->second < config.layouts.size()) {
+                return &config.layouts[it->second];
             }
-            currentLayout = Layout();
-            currentZone = Zone();
-            inLayout = true;
-            inZone = false;
-            continue;
         }
+    }
+
+    // Memoized mapping lookup (most specific match wins, see compileMappings)
+    auto monIt = m_mappingMemo.find(monitorName);
+    if (monIt == m_mappingMemo.end()) {
+        monIt = m_mappingMemo.emplace(monitorName, std::unordered_map<int, int>{}).first;
+    }
 
-        if (line == "[[layouts.zones]]") {
-            if (inZone && !currentZone.name.empty()) {
-                currentLayout.zones.push_back(currentZone);
+    int  mapped = -1;
+    auto wsIt   = monIt->second.find(workspace);
+    if (wsIt != monIt->second.end()) {
+        g_stats.count(Counter::MappingCacheHits);
+        mapped = wsIt->second;
+    } else {
+        g_stats.count(Counter::MappingCacheMisses);
+        for (const auto& compiled : config.compiledMappings) {
+            if (compiled.matches(monitorName, workspace)) {
+                mapped = static_cast<int>(compiled.layoutIdx);
+                break;
             }
-            currentZone = Zone();
-            currentZone.index = static_cast<int>(currentLayout.zones.size());
-            inZone = true;
-            continue;
         }
+        monIt->second.emplace(workspace, mapped);
+        HZ_LOG_DEBUG("getLayoutForMonitor: mon=%s ws=%d -> %s", monitorName.c_str(), workspace,
+                     mapped >= 0 ? config.layouts[mapped].name.c_str() : "(no mapping)");
+    }
 
-        size_t eq = line.find('=');
-        if (eq == std::string::npos) continue;
-
-        std::string key = line.substr(0, eq);
-        std::string value = line.substr(eq + 1);
-        trim(key);
-        trim(value);
-
-        if (inZone) {
-            if (key == "name") currentZone.name = parseString(value);
-            else if (key == "x") currentZone.x = std::stod(value) / 100.0;
-            else if (key == "y") currentZone.y = std::stod(value) / 100.0;
-            else if (key == "width") currentZone.width = std::stod(value) / 100.0;
-            else if (key == "height") currentZone.height = std::stod(value) / 100.0;
-        } else if (inLayout) {
-            if (key == "name") currentLayout.name = parseString(value);
-            else if (key == "spacing_h") currentLayout.spacingH = std::stoi(value);
-            else if (key == "spacing_v") currentLayout.spacingV = std::stoi(value);
-            else if (key == "hotkey") currentLayout.hotkey = parseString(value);
-            else if (key == "template") currentLayout.templateType = parseString(value);
-            else if (key == "columns") currentLayout.columns = std::stoi(value);
-            else if (key == "rows") currentLayout.rows = std::stoi(value);
-        }
+    if (mapped >= 0 && static_cast<size_t>(mapped) < config.layouts.size()) {
+        return &config.layouts[mapped];
     }
 
-    if (inLayout && !currentLayout.name.empty()) {
-        if (inZone && !currentZone.name.empty()) {
-            currentLayout.zones.push_back(currentZone);
+    // Fall back to active layout
+    const auto& active = activeLayout(config);
+    if (!active.empty()) {
+        auto it = config.layoutIndex.find(active);
+        if (it != config.layoutIndex.end() && it->second < config.layouts.size()) {
+            return &config.layouts[it->second];
         }
-        layouts.push_back(currentLayout);
     }
 
-    return layouts;
-}
-
-std::vector<LayoutMapping> LayoutManager::loadMappings(const std::string& path) {
-    std::vector<LayoutMapping> mappings;
-    std::ifstream file(path);
-    if (!file.is_open()) {
-        return mappings;
+    // Last resort: first layout
+    if (!config.layouts.empty()) {
+        return &config.layouts[0];
     }
 
-    std::string line;
-    LayoutMapping currentMapping;
-    bool inMapping = false;
-
-    auto trim = [](std::string& s) {
-        s.erase(0, s.find_first_not_of(" \t\r\n"));
-        s.erase(s.find_last_not_of(" \t\r\n") + 1);
-    };
-
-    auto parseString = [](const std::string& value) -> std::string {
-        std::string result = value;
-        if (result.front() == '"') result.erase(0, 1);
-        if (result.back() == '"') result.pop_back();
-        return result;
-    };
+    return nullptr;
+}
 
-    while (std::getline(file, line)) {
-        trim(line);
-        if (line.empty() || line[0] == '#') continue;
+void LayoutManager::switchLayout(const Config& config, const std::string& layoutName) {
+    auto it = config.layoutIndex.find(layoutName);
+    if (it != config.layoutIndex.end()) {
+        m_activeLayout = layoutName;
+    }
+}
 
-        if (line == "[[mappings]]") {
-            if (inMapping && !currentMapping.layout.empty()) {
-                mappings.push_back(currentMapping);
-            }
-            currentMapping = LayoutMapping();
-            currentMapping.workspaces = "*";
-            inMapping = true;
-            continue;
-        }
+void LayoutManager::cycleLayout(const Config& config, int direction) {
+    if (config.layouts.empty()) {
+        return;
+    }
 
-        // Skip other sections
-        if (line.substr(0, 2) == "[[" && line != "[[mappings]]") {
-            if (inMapping && !currentMapping.layout.empty()) {
-                mappings.push_back(currentMapping);
-            }
-            inMapping = false;
-            continue;
-        }
+    auto it = config.layoutIndex.find(activeLayout(config));
+    size_t currentIdx = (it != config.layoutIndex.end()) ? it->second : 0;
 
-        if (!inMapping) continue;
+    int newIdx = static_cast<int>(currentIdx) + direction;
+    int count  = static_cast<int>(config.layouts.size());
 
-        size_t eq = line.find('=');
-        if (eq == std::string::npos) continue;
+    newIdx = ((newIdx % count) + count) % count;
 
-        std::string key = line.substr(0, eq);
-        std::string value = line.substr(eq + 1);
-        trim(key);
-        trim(value);
+    m_activeLayout = config.layouts[newIdx].name;
+}
 
-        if (key == "monitor") currentMapping.monitor = parseString(value);
-        else if (key == "workspaces") currentMapping.workspaces = parseString(value);
-        else if (key == "layout") currentMapping.layout = parseString(value);
+bool LayoutManager::switchMonitorLayout(const Config& config, const std::string& monitorName,
+                                        const std::string& layoutName) {
+    if (!config.layoutIndex.contains(layoutName)) {
+        return false;
     }
+    m_monitorLayouts[monitorName] = layoutName;
+    return true;
+}
 
-    if (inMapping && !currentMapping.layout.empty()) {
-        mappings.push_back(currentMapping);
+const std::string& LayoutManager::activeLayout(const Config& config) const {
+    // A switched-to layout that vanished in a reload falls back to the default
+    if (!m_activeLayout.empty() && config.layoutIndex.contains(m_activeLayout)) {
+        return m_activeLayout;
     }
-
-    return mappings;
+    return config.activeLayout;
 }
 
 }  // namespace HyprZones
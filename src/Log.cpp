@@ -0,0 +1,233 @@
+#include "hyprzones/Log.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+#include <ctime>
+#include <fcntl.h>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+
+namespace HyprZones::Log {
+
+namespace {
+
+constexpr size_t SLOT_COUNT     = 1024;  // power of two
+constexpr auto   FLUSH_INTERVAL = std::chrono::milliseconds(100);
+
+// One message. seq implements the bounded MPMC queue protocol (Vyukov):
+// seq == pos means free for the producer claiming pos, seq == pos + 1
+// means written and ready for the consumer.
+struct alignas(64) Slot {
+    std::atomic<uint64_t> seq{0};
+    int64_t               timeNs = 0;
+    uint16_t              length = 0;
+    LogLevel              level  = LogLevel::Info;
+    char                  text[232];
+};
+static_assert(sizeof(Slot) == 256);
+
+struct Ring {
+    Ring() {
+        for (size_t i = 0; i < SLOT_COUNT; ++i) {
+            slots[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    std::array<Slot, SLOT_COUNT> slots;
+
+    alignas(64) std::atomic<uint64_t> head{0};  // next position producers claim
+    alignas(64) std::atomic<uint64_t> tail{0};  // next position to flush (written by the flusher only)
+    uint64_t reportedDropped = 0;               // dropped count already logged (flusher only)
+    std::atomic<uint64_t> dropped{0};           // messages lost to a full ring, ever
+};
+
+Ring g_ring;
+
+#ifdef NDEBUG
+std::atomic<LogLevel> g_level{LogLevel::Info};
+#else
+std::atomic<LogLevel> g_level{LogLevel::Debug};
+#endif
+
+std::mutex              g_flushMutex;
+std::condition_variable g_wake;
+std::thread             g_flusher;
+bool                    g_stopping = false;
+int                     g_fd       = -1;
+
+const char* levelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info: return "INFO ";
+        case LogLevel::Warn: return "WARN ";
+        case LogLevel::Error: return "ERROR";
+    }
+    return "?    ";
+}
+
+void appendLine(std::string& out, int64_t timeNs, LogLevel level, const char* text, size_t length) {
+    time_t seconds = static_cast<time_t>(timeNs / 1'000'000'000);
+    tm     local{};
+    localtime_r(&seconds, &local);
+
+    char prefix[48];
+    int  n = std::snprintf(prefix, sizeof(prefix), "%04d-%02d-%02d %02d:%02d:%02d.%03d %s ",
+                           local.tm_year + 1900, local.tm_mon + 1, local.tm_mday, local.tm_hour, local.tm_min,
+                           local.tm_sec, static_cast<int>(timeNs / 1'000'000 % 1000), levelName(level));
+    out.append(prefix, n > 0 ? static_cast<size_t>(n) : 0);
+    out.append(text, length);
+    out += '\n';
+}
+
+void writeAll(const std::string& data) {
+    const char* p    = data.data();
+    size_t      left = data.size();
+    while (left > 0) {
+        ssize_t n = ::write(g_fd, p, left);
+        if (n <= 0) {
+            return;  // nowhere to report it; drop the batch
+        }
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+}
+
+// Flusher thread: move everything written so far into one write()
+void drain(std::string& batch) {
+    uint64_t dropped = g_ring.dropped.load(std::memory_order_relaxed);
+    if (dropped != g_ring.reportedDropped) {
+        char text[64];
+        int  n   = std::snprintf(text, sizeof(text), "%llu log messages dropped (ring full)",
+                                 static_cast<unsigned long long>(dropped - g_ring.reportedDropped));
+        g_ring.reportedDropped = dropped;
+        auto now = std::chrono::system_clock::now().time_since_epoch();
+        appendLine(batch, std::chrono::duration_cast<std::chrono::nanoseconds>(now).count(), LogLevel::Warn, text,
+                   static_cast<size_t>(n));
+    }
+
+    uint64_t tail = g_ring.tail.load(std::memory_order_relaxed);
+    while (true) {
+        Slot& slot = g_ring.slots[tail & (SLOT_COUNT - 1)];
+        if (slot.seq.load(std::memory_order_acquire) != tail + 1) {
+            break;
+        }
+        appendLine(batch, slot.timeNs, slot.level, slot.text, slot.length);
+        slot.seq.store(tail + SLOT_COUNT, std::memory_order_release);
+        g_ring.tail.store(++tail, std::memory_order_relaxed);
+    }
+
+    if (!batch.empty() && g_fd >= 0) {
+        writeAll(batch);
+    }
+    batch.clear();
+}
+
+void run() {
+    std::string batch;
+    batch.reserve(SLOT_COUNT * 96);
+
+    std::unique_lock lock(g_flushMutex);
+    while (true) {
+        g_wake.wait_for(lock, FLUSH_INTERVAL);
+        bool stopping = g_stopping;
+        lock.unlock();
+        drain(batch);
+        if (stopping) {
+            return;
+        }
+        lock.lock();
+    }
+}
+
+}  // namespace
+
+bool start(const std::string& path) {
+    if (g_flusher.joinable()) {
+        return true;
+    }
+
+    g_fd = open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (g_fd < 0) {
+        return false;
+    }
+
+    g_stopping = false;
+    g_flusher  = std::thread(run);
+    return true;
+}
+
+void stop() {
+    if (g_flusher.joinable()) {
+        {
+            std::lock_guard lock(g_flushMutex);
+            g_stopping = true;
+        }
+        g_wake.notify_one();
+        g_flusher.join();
+    }
+
+    if (g_fd >= 0) {
+        close(g_fd);
+        g_fd = -1;
+    }
+}
+
+void setLevel(LogLevel level) {
+    g_level.store(level, std::memory_order_relaxed);
+}
+
+bool enabled(LogLevel level) {
+    return level >= g_level.load(std::memory_order_relaxed);
+}
+
+uint64_t droppedCount() {
+    return g_ring.dropped.load(std::memory_order_relaxed);
+}
+
+void write(LogLevel level, const char* format, ...) {
+    uint64_t pos = g_ring.head.load(std::memory_order_relaxed);
+    Slot*    slot;
+    while (true) {
+        slot         = &g_ring.slots[pos & (SLOT_COUNT - 1)];
+        uint64_t seq = slot->seq.load(std::memory_order_acquire);
+        auto     lag = static_cast<int64_t>(seq - pos);
+        if (lag == 0) {
+            if (g_ring.head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (lag < 0) {
+            g_ring.dropped.fetch_add(1, std::memory_order_relaxed);  // full: never block the caller
+            return;
+        } else {
+            pos = g_ring.head.load(std::memory_order_relaxed);
+        }
+    }
+
+    // system_clock reads the vDSO, not a syscall
+    auto now     = std::chrono::system_clock::now().time_since_epoch();
+    slot->timeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    slot->level  = level;
+
+    va_list args;
+    va_start(args, format);
+    int n = std::vsnprintf(slot->text, sizeof(slot->text), format, args);
+    va_end(args);
+    slot->length = static_cast<uint16_t>(n < 0 ? 0 : std::min<size_t>(n, sizeof(slot->text) - 1));
+
+    slot->seq.store(pos + 1, std::memory_order_release);
+
+    // The 100 ms tick flushes everything else; only the message that fills
+    // the ring to half wakes the flusher early, so bursts don't overflow
+    // before the next tick and the common path makes no syscall
+    uint64_t used = pos + 1 - g_ring.tail.load(std::memory_order_relaxed);
+    if (used == SLOT_COUNT / 2) {
+        g_wake.notify_one();
+    }
+}
+
+}  // namespace HyprZones::Log
@@ -0,0 +1,53 @@
+#include "hyprzones/MappedFile.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace HyprZones {
+
+bool MappedFile::open(const std::string& path) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    m_size  = static_cast<size_t>(st.st_size);
+    m_mtime = st.st_mtim;
+
+    // mmap rejects zero-length mappings; an empty file is still "open"
+    if (m_size > 0) {
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            ::close(fd);
+            m_size = 0;
+            return false;
+        }
+        m_data = data;
+    }
+
+    ::close(fd);
+    m_open = true;
+    return true;
+}
+
+void MappedFile::close() {
+    if (m_data) {
+        munmap(m_data, m_size);
+    }
+    m_data  = nullptr;
+    m_size  = 0;
+    m_mtime = {};
+    m_open  = false;
+}
+
+}  // namespace HyprZones
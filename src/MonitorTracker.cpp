@@ -0,0 +1,71 @@
+#include "hyprzones/MonitorTracker.hpp"
+
+namespace HyprZones {
+
+const MonitorOverride* findMonitorOverride(const Config& config, std::string_view monitorName) {
+    const MonitorOverride* wildcard = nullptr;
+    for (const auto& entry : config.monitorOverrides) {
+        if (entry.monitor == monitorName)
+            return &entry;
+        if (!wildcard && entry.monitor == "*")
+            wildcard = &entry;
+    }
+    return wildcard;
+}
+
+MonitorGeometry applyMonitorOverride(const MonitorGeometry& reported, const MonitorOverride* override) {
+    if (!override)
+        return reported;
+
+    auto pick = [](int configured, double fallback) { return configured >= 0 ? configured : fallback; };
+
+    MonitorGeometry geometry = reported;
+    double          left     = pick(override->reservedLeft, reported.reservedLeft);
+    double          right    = pick(override->reservedRight, reported.reservedRight);
+    double          top      = pick(override->reservedTop, reported.reservedTop);
+    double          bottom   = pick(override->reservedBottom, reported.reservedBottom);
+    if (left + right < reported.width) {
+        geometry.reservedLeft  = left;
+        geometry.reservedRight = right;
+    }
+    if (top + bottom < reported.height) {
+        geometry.reservedTop    = top;
+        geometry.reservedBottom = bottom;
+    }
+    return geometry;
+}
+
+bool MonitorTracker::update(const std::string& name, const MonitorGeometry& reported, const Config& config) {
+    MonitorGeometry effective = applyMonitorOverride(reported, findMonitorOverride(config, name));
+
+    auto [it, inserted] = m_monitors.try_emplace(name, Record{reported, effective});
+    if (inserted)
+        return true;
+
+    it->second.reported = reported;
+    if (it->second.effective == effective)
+        return false;
+    it->second.effective = effective;
+    return true;
+}
+
+void MonitorTracker::reapply(const Config& config, std::vector<std::string>& changed) {
+    for (auto& [name, record] : m_monitors) {
+        MonitorGeometry effective = applyMonitorOverride(record.reported, findMonitorOverride(config, name));
+        if (effective == record.effective)
+            continue;
+        record.effective = effective;
+        changed.push_back(name);
+    }
+}
+
+bool MonitorTracker::remove(const std::string& name) {
+    return m_monitors.erase(name) > 0;
+}
+
+const MonitorGeometry* MonitorTracker::find(const std::string& name) const {
+    auto it = m_monitors.find(name);
+    return it == m_monitors.end() ? nullptr : &it->second.effective;
+}
+
+}  // namespace HyprZones
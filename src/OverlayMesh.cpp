@@ -0,0 +1,162 @@
+#include "hyprzones/OverlayMesh.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace HyprZones {
+
+namespace {
+
+struct Rgba {
+    float r, g, b, a;
+};
+
+// Premultiplied, as the compositor blends with (ONE, ONE_MINUS_SRC_ALPHA)
+Rgba premultiply(const Color& c, float alpha) {
+    float a = c.a * alpha;
+    return {c.r * a, c.g * a, c.b * a, a};
+}
+
+void addQuad(std::vector<OverlayVertex>& out, float x0, float y0, float x1, float y1, const Rgba& c) {
+    if (x1 <= x0 || y1 <= y0) {
+        return;
+    }
+    out.push_back({x0, y0, c.r, c.g, c.b, c.a});
+    out.push_back({x1, y0, c.r, c.g, c.b, c.a});
+    out.push_back({x0, y1, c.r, c.g, c.b, c.a});
+    out.push_back({x1, y0, c.r, c.g, c.b, c.a});
+    out.push_back({x1, y1, c.r, c.g, c.b, c.a});
+    out.push_back({x0, y1, c.r, c.g, c.b, c.a});
+}
+
+// Destination rect textured with the source rect of a width x height texture
+void addTexQuad(std::vector<OverlayTexVertex>& out, const AtlasQuad& quad, double width, double height) {
+    auto x0 = static_cast<float>(quad.dst.x);
+    auto y0 = static_cast<float>(quad.dst.y);
+    auto x1 = static_cast<float>(quad.dst.x + quad.dst.w);
+    auto y1 = static_cast<float>(quad.dst.y + quad.dst.h);
+    auto u0 = static_cast<float>(quad.src.x / width);
+    auto v0 = static_cast<float>(quad.src.y / height);
+    auto u1 = static_cast<float>((quad.src.x + quad.src.w) / width);
+    auto v1 = static_cast<float>((quad.src.y + quad.src.h) / height);
+    out.push_back({x0, y0, u0, v0});
+    out.push_back({x1, y0, u1, v0});
+    out.push_back({x0, y1, u0, v1});
+    out.push_back({x1, y0, u1, v0});
+    out.push_back({x1, y1, u1, v1});
+    out.push_back({x0, y1, u0, v1});
+}
+
+}  // namespace
+
+bool OverlayMesh::update(const ResolvedLayout& resolved, double originX, double originY, double scale,
+                         const ZoneSelection& highlighted, const OverlayStyle& style) {
+    if (m_valid && resolved.key == m_layoutKey && resolved.layout.zones.size() == m_zoneCount &&
+        originX == m_originX && originY == m_originY && scale == m_scale && highlighted == m_highlighted &&
+        style == m_style) {
+        return false;
+    }
+
+    m_valid       = true;
+    m_layoutKey   = resolved.key;
+    m_zoneCount   = resolved.layout.zones.size();
+    m_originX     = originX;
+    m_originY     = originY;
+    m_scale       = scale;
+    m_highlighted = highlighted;
+    m_style       = style;
+    rebuild(resolved);
+    ++m_version;
+    return true;
+}
+
+void OverlayMesh::rebuild(const ResolvedLayout& resolved) {
+    const auto& zones = resolved.layout.zones;
+
+    Rgba  inactive  = premultiply(m_style.inactive, m_style.alpha);
+    Rgba  highlight = premultiply(m_style.highlight, m_style.alpha);
+    Rgba  border    = premultiply(m_style.border, m_style.alpha);
+    float b         = static_cast<float>(std::round(m_style.borderWidth * m_scale));
+
+    m_vertices.clear();
+    m_vertices.reserve(zones.size() * VERTICES_PER_ZONE);
+
+    for (size_t i = 0; i < zones.size(); ++i) {
+        const Zone& zone = zones[i];
+
+        // Whole framebuffer pixels, like the compositor's own rect and border passes
+        float x0 = static_cast<float>(std::round((zone.pixelX - m_originX) * m_scale));
+        float y0 = static_cast<float>(std::round((zone.pixelY - m_originY) * m_scale));
+        float x1 = static_cast<float>(std::round((zone.pixelX + zone.pixelW - m_originX) * m_scale));
+        float y1 = static_cast<float>(std::round((zone.pixelY + zone.pixelH - m_originY) * m_scale));
+
+        addQuad(m_vertices, x0, y0, x1, y1, m_highlighted.contains(static_cast<int>(i)) ? highlight : inactive);
+
+        if (b > 0) {
+            addQuad(m_vertices, x0 - b, y0 - b, x1 + b, y0, border);  // top, corners included
+            addQuad(m_vertices, x0 - b, y1, x1 + b, y1 + b, border);  // bottom, corners included
+            addQuad(m_vertices, x0 - b, y0, x0, y1, border);          // left
+            addQuad(m_vertices, x1, y0, x1 + b, y1, border);          // right
+        }
+    }
+}
+
+bool OverlayTextMesh::update(const ResolvedLayout& resolved, double originX, double originY, double scale,
+                             const DigitAtlasMetrics& badges, std::span<const OverlayLabel> labels) {
+    if (m_valid && resolved.key == m_layoutKey && resolved.layout.zones.size() == m_zoneCount &&
+        originX == m_originX && originY == m_originY && scale == m_scale && badges == m_badges &&
+        std::equal(labels.begin(), labels.end(), m_labels.begin(), m_labels.end())) {
+        return false;
+    }
+
+    m_valid     = true;
+    m_layoutKey = resolved.key;
+    m_zoneCount = resolved.layout.zones.size();
+    m_originX   = originX;
+    m_originY   = originY;
+    m_scale     = scale;
+    m_badges    = badges;
+    m_labels.assign(labels.begin(), labels.end());
+    rebuild(resolved);
+    ++m_version;
+    return true;
+}
+
+void OverlayTextMesh::rebuild(const ResolvedLayout& resolved) {
+    const auto& zones  = resolved.layout.zones;
+    bool        badges = m_badges.badgeSize > 0 && m_badges.width() > 0 && m_badges.height > 0;
+    m_vertices.clear();
+
+    // Circle plus up to three digits covers the usual layouts without regrowing
+    m_vertices.reserve((badges ? zones.size() * 4 : 0) * VERTICES_PER_QUAD + m_labels.size() * VERTICES_PER_QUAD);
+
+    BadgeQuads quads;
+    for (size_t i = 0; badges && i < zones.size(); ++i) {
+        const Zone& zone    = zones[i];
+        double      centerX = (zone.pixelX - m_originX + zone.pixelW / 2) * m_scale;
+        double      centerY = (zone.pixelY - m_originY + zone.pixelH / 2) * m_scale;
+
+        size_t count = composeBadge(m_badges, static_cast<int>(i) + 1, centerX, centerY, quads);
+        for (size_t q = 0; q < count; ++q) {
+            addTexQuad(m_vertices, quads[q], m_badges.width(), m_badges.height);
+        }
+    }
+    m_badgeVertices = m_vertices.size();
+
+    // Below the badge with a small gap, or centred when there is none
+    double offsetY = badges ? m_badges.badgeSize / 2.0 + 4 * m_scale : 0.0;
+    for (const auto& label : m_labels) {
+        if (label.zone < 0 || label.zone >= static_cast<int>(zones.size())) {
+            addTexQuad(m_vertices, {}, 1, 1);  // keeps label i at its slot; nothing drawn
+            continue;
+        }
+        const Zone& zone    = zones[label.zone];
+        double      centerX = (zone.pixelX - m_originX + zone.pixelW / 2) * m_scale;
+        double      centerY = (zone.pixelY - m_originY + zone.pixelH / 2) * m_scale;
+        double      top     = badges ? centerY + offsetY : centerY - label.height / 2.0;
+
+        AtlasQuad quad{{0, 0, 1, 1}, {centerX - label.width / 2.0, top, label.width, label.height}};
+        addTexQuad(m_vertices, quad, 1, 1);
+    }
+}
+
+}  // namespace HyprZones
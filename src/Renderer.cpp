@@ -1,15 +1,12 @@
 #include "hyprzones/Renderer.hpp"
 #include "hyprzones/Globals.hpp"
+#include "hyprzones/Stats.hpp"
 
 #include <hyprland/src/Compositor.hpp>
 #include <hyprland/src/render/Renderer.hpp>
 #include <hyprland/src/render/OpenGL.hpp>
 #include <hyprland/src/render/Texture.hpp>
-#include <hyprland/src/render/pass/RectPassElement.hpp>
-#include <hyprland/src/render/pass/BorderPassElement.hpp>
-#include <hyprland/src/render/pass/TexPassElement.hpp>
 #include <hyprland/src/helpers/Monitor.hpp>
-#include <hyprland/src/config/ConfigDataValues.hpp>
 
 #include <cairo/cairo.h>
 #include <pango/pangocairo.h>
@@ -18,10 +15,81 @@
 
 namespace HyprZones {
 
-Renderer::Renderer() : m_visible(false), m_alpha(0.8f) {}
+// Worker thread: shape and rasterize a zone name into a rounded dark plate
+static LabelBitmap rasterizeLabel(const LabelKey& key) {
+    float scale    = key.scaleKey / 100.0f;
+    int   fontSize = static_cast<int>(14 * scale);
+    int   padX     = static_cast<int>(8 * scale);
+    int   padY     = static_cast<int>(3 * scale);
+
+    // Each call owns its surfaces and layouts, so workers never share pango state
+    PangoFontDescription* fontDesc = pango_font_description_from_string("Sans Bold");
+    pango_font_description_set_absolute_size(fontDesc, fontSize * PANGO_SCALE);
+
+    cairo_surface_t* scratch = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, 1, 1);
+    cairo_t* scratchCr = cairo_create(scratch);
+    PangoLayout* measure = pango_cairo_create_layout(scratchCr);
+    pango_layout_set_font_description(measure, fontDesc);
+    pango_layout_set_text(measure, key.text.c_str(), -1);
+    int textW, textH;
+    pango_layout_get_pixel_size(measure, &textW, &textH);
+    g_object_unref(measure);
+    cairo_destroy(scratchCr);
+    cairo_surface_destroy(scratch);
+
+    LabelBitmap bitmap;
+    bitmap.width  = std::max(1, textW + padX * 2);
+    bitmap.height = std::max(1, textH + padY * 2);
+
+    cairo_surface_t* surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, bitmap.width, bitmap.height);
+    cairo_t* cr = cairo_create(surface);
+
+    // Plate
+    double r = bitmap.height / 2.0;
+    cairo_new_sub_path(cr);
+    cairo_arc(cr, bitmap.width - r, r, r, -M_PI / 2, M_PI / 2);
+    cairo_arc(cr, r, r, r, M_PI / 2, 3 * M_PI / 2);
+    cairo_close_path(cr);
+    cairo_set_source_rgba(cr, 0.0, 0.0, 0.0, 0.6);
+    cairo_fill(cr);
+
+    // Text
+    PangoLayout* layout = pango_cairo_create_layout(cr);
+    pango_layout_set_font_description(layout, fontDesc);
+    pango_layout_set_text(layout, key.text.c_str(), -1);
+    cairo_set_source_rgba(cr, (key.color >> 24 & 0xff) / 255.0, (key.color >> 16 & 0xff) / 255.0,
+                          (key.color >> 8 & 0xff) / 255.0, (key.color & 0xff) / 255.0);
+    cairo_move_to(cr, padX, padY);
+    pango_cairo_show_layout(cr, layout);
+
+    g_object_unref(layout);
+    pango_font_description_free(fontDesc);
+    cairo_destroy(cr);
+
+    cairo_surface_flush(surface);
+    bitmap.stride = cairo_image_surface_get_stride(surface);
+    const unsigned char* data = cairo_image_surface_get_data(surface);
+    bitmap.pixels.assign(data, data + static_cast<size_t>(bitmap.stride) * bitmap.height);
+    cairo_surface_destroy(surface);
+    return bitmap;
+}
+
+static uint32_t packColor(const Color& c) {
+    auto channel = [](float v) { return static_cast<uint32_t>(std::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f); };
+    return channel(c.r) << 24 | channel(c.g) << 16 | channel(c.b) << 8 | channel(c.a);
+}
+
+Renderer::Renderer() : m_visible(false), m_alpha(0.8f), m_labels(rasterizeLabel) {
+    m_labels.start();
+}
 
 Renderer::~Renderer() {
+    m_labels.stop();
     clearCache();
+    for (auto& [monitor, batch] : m_batches) {
+        releaseZoneBatch(*batch);
+    }
+    releaseZoneBatchShader();
 }
 
 void Renderer::show(bool manual) {
@@ -34,38 +102,79 @@ void Renderer::show(bool manual) {
     }
 }
 
+// Atlases stay: the next drag draws its numbers without rasterizing
 void Renderer::hide() {
     if (m_visible) {
         m_visible = false;
         m_manuallyOpened = false;
-        clearCache();
+        m_cachedLayoutGeneration = 0;
     }
 }
 
 void Renderer::clearCache() {
-    m_cachedNumberTextures.clear();
-    m_cachedLayoutName.clear();
+    m_numberAtlases.clear();
+    m_labels.clear();
+    m_cachedLayoutGeneration = 0;
 }
 
 void Renderer::invalidateCache() {
     m_needsRedraw = true;
 }
 
-SP<CTexture> Renderer::getOrCreateNumberTexture(int number, float scale) {
-    std::string key = std::to_string(number) + "_" + std::to_string(static_cast<int>(scale * 100));
+void Renderer::forgetMonitor(void* monitor) {
+    auto it = m_batches.find(monitor);
+    if (it == m_batches.end())
+        return;
+    releaseZoneBatch(*it->second);
+    m_batches.erase(it);
+}
+
+bool Renderer::uploadLabels() {
+    size_t uploaded = m_labels.upload([](const LabelBitmap& bitmap) {
+        g_stats.count(Counter::TexturesCreated);
+        return makeShared<CTexture>(
+            DRM_FORMAT_ARGB8888,
+            const_cast<unsigned char*>(bitmap.pixels.data()),
+            bitmap.stride,
+            Vector2D(bitmap.width, bitmap.height),
+            true
+        );
+    });
+    return uploaded > 0;
+}
 
-    auto it = m_cachedNumberTextures.find(key);
-    if (it != m_cachedNumberTextures.end()) {
-        return it->second;
+// Rasterize the circle background and the digits 0-9 of one scale into a single texture
+const Renderer::NumberAtlas* Renderer::getOrCreateNumberAtlas(float scale) {
+    int key = atlasScaleKey(scale);
+    if (const NumberAtlas* atlas = m_numberAtlases.find(key)) {
+        g_stats.count(Counter::TextureCacheHits);
+        return atlas;
     }
 
-    // Create texture for this number
-    std::string text = std::to_string(number);
-    int fontSize = static_cast<int>(24 * scale);
-    int padding = static_cast<int>(8 * scale);
-    int texSize = fontSize + padding * 2;
+    DigitAtlasMetrics metrics = DigitAtlasMetrics::forScale(scale);
+
+    PangoFontDescription* fontDesc = pango_font_description_from_string("Sans Bold");
+    pango_font_description_set_absolute_size(fontDesc, metrics.fontSize * PANGO_SCALE);
+
+    // Widest digit decides the cell width
+    cairo_surface_t* scratch = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, 1, 1);
+    cairo_t* scratchCr = cairo_create(scratch);
+    PangoLayout* measure = pango_cairo_create_layout(scratchCr);
+    pango_layout_set_font_description(measure, fontDesc);
+    int digitH[10];
+    for (int d = 0; d < 10; ++d) {
+        char text[2] = {static_cast<char>('0' + d), 0};
+        int w, h;
+        pango_layout_set_text(measure, text, -1);
+        pango_layout_get_pixel_size(measure, &w, &h);
+        metrics.digitWidth = std::max(metrics.digitWidth, w);
+        digitH[d] = h;
+    }
+    g_object_unref(measure);
+    cairo_destroy(scratchCr);
+    cairo_surface_destroy(scratch);
 
-    cairo_surface_t* surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, texSize, texSize);
+    cairo_surface_t* surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, metrics.width(), metrics.height);
     cairo_t* cr = cairo_create(surface);
 
     // Clear
@@ -73,24 +182,25 @@ SP<CTexture> Renderer::getOrCreateNumberTexture(int number, float scale) {
     cairo_paint(cr);
 
     // Circle background
-    double radius = texSize / 2.0;
-    cairo_arc(cr, texSize / 2.0, texSize / 2.0, radius - 2, 0, 2 * M_PI);
+    double radius = metrics.badgeSize / 2.0;
+    cairo_arc(cr, radius, metrics.height / 2.0, radius - 2, 0, 2 * M_PI);
     cairo_set_source_rgba(cr, 0.0, 0.0, 0.0, 0.7);
     cairo_fill(cr);
 
-    // Text
+    // Digits, each centred in its cell
     PangoLayout* layout = pango_cairo_create_layout(cr);
-    PangoFontDescription* fontDesc = pango_font_description_from_string("Sans Bold");
-    pango_font_description_set_absolute_size(fontDesc, fontSize * PANGO_SCALE);
     pango_layout_set_font_description(layout, fontDesc);
-    pango_layout_set_text(layout, text.c_str(), -1);
-
-    int textW, textH;
-    pango_layout_get_pixel_size(layout, &textW, &textH);
-
     cairo_set_source_rgba(cr, 1.0, 1.0, 1.0, 1.0);
-    cairo_move_to(cr, (texSize - textW) / 2.0, (texSize - textH) / 2.0);
-    pango_cairo_show_layout(cr, layout);
+    for (int d = 0; d < 10; ++d) {
+        char text[2] = {static_cast<char>('0' + d), 0};
+        int textW, textH;
+        pango_layout_set_text(layout, text, -1);
+        pango_layout_get_pixel_size(layout, &textW, &textH);
+
+        AtlasRect cell = metrics.digit(d);
+        cairo_move_to(cr, cell.x + (cell.w - textW) / 2.0, (cell.h - digitH[d]) / 2.0);
+        pango_cairo_show_layout(cr, layout);
+    }
 
     g_object_unref(layout);
     pango_font_description_free(fontDesc);
@@ -104,112 +214,88 @@ SP<CTexture> Renderer::getOrCreateNumberTexture(int number, float scale) {
         DRM_FORMAT_ARGB8888,
         data,
         stride,
-        Vector2D(texSize, texSize),
+        Vector2D(metrics.width(), metrics.height),
         true
     );
 
     cairo_surface_destroy(surface);
+    g_stats.count(Counter::TexturesCreated);
 
-    m_cachedNumberTextures[key] = texture;
-    return texture;
+    return &m_numberAtlases.insert(key, {texture, metrics});
 }
 
-void Renderer::renderOverlay(void* monitorPtr, const Layout& layout,
-                             const std::vector<int>& highlightedZones,
+void Renderer::renderOverlay(void* monitorPtr, const ResolvedLayout& resolved,
+                             const ZoneSelection& highlightedZones,
                              const Config& config) {
     if (!m_visible || !monitorPtr) {
         return;
     }
 
-    auto* monitor = static_cast<CMonitor*>(monitorPtr);
+    auto*         monitor = static_cast<CMonitor*>(monitorPtr);
+    const Layout& layout  = resolved.layout;
 
     // Check if layout changed - invalidate cache
-    if (m_cachedLayoutName != layout.name) {
-        m_cachedLayoutName = layout.name;
+    if (m_cachedLayoutGeneration != layout.generation) {
+        m_cachedLayoutGeneration = layout.generation;
         m_needsRedraw = true;
     }
 
-    // Draw zone rectangles
-    for (size_t i = 0; i < layout.zones.size(); ++i) {
-        bool highlighted = std::find(highlightedZones.begin(),
-                                     highlightedZones.end(),
-                                     static_cast<int>(i)) != highlightedZones.end();
-        drawZone(monitor, layout.zones[i], highlighted, config);
-    }
-
-    // Draw cached zone numbers
-    if (config.showZoneNumbers) {
-        for (size_t i = 0; i < layout.zones.size(); ++i) {
-            drawCachedNumber(monitor, layout.zones[i], static_cast<int>(i) + 1);
-        }
-    }
+    // Zone rectangles, numbers from the digit atlas of this monitor's scale, and names
+    const NumberAtlas* atlas = config.showZoneNumbers ? getOrCreateNumberAtlas(monitor->m_scale) : nullptr;
+    if (atlas && !atlas->texture)
+        atlas = nullptr;
+    drawZones(monitor, resolved, highlightedZones, config, atlas);
 
     m_needsRedraw = false;
 }
 
-void Renderer::drawZone(void* monitorPtr, const Zone& zone, bool highlighted, const Config& config) {
+// All fills, borders, number badges and name labels in one pass element;
+// the meshes are only rebuilt when the layout, highlight, style, atlas or
+// set of ready labels changed
+void Renderer::drawZones(void* monitorPtr, const ResolvedLayout& resolved, const ZoneSelection& highlightedZones,
+                         const Config& config, const NumberAtlas* atlas) {
     auto* monitor = static_cast<CMonitor*>(monitorPtr);
     if (!monitor)
         return;
 
-    CBox box = {
-        zone.pixelX - monitor->m_position.x,
-        zone.pixelY - monitor->m_position.y,
-        zone.pixelW,
-        zone.pixelH
-    };
-    box.scale(monitor->m_scale);
-
-    const Color& col = highlighted ? config.highlightColor : config.inactiveColor;
-    CHyprColor fillColor(col.r, col.g, col.b, col.a * m_alpha);
-
-    CRectPassElement::SRectData rectData;
-    rectData.box = box;
-    rectData.color = fillColor;
-    rectData.round = 0;
-    g_pHyprRenderer->m_renderPass.add(makeUnique<CRectPassElement>(rectData));
-
-    const Color& borderCol = config.borderColor;
-    CHyprColor borderColor(borderCol.r, borderCol.g, borderCol.b, borderCol.a * m_alpha);
-
-    CGradientValueData grad;
-    grad.m_colors.push_back(borderColor);
-
-    CBorderPassElement::SBorderData borderData;
-    borderData.box = box;
-    borderData.grad1 = grad;
-    borderData.round = 0;
-    borderData.borderSize = config.borderWidth;
-    borderData.a = m_alpha;
-    g_pHyprRenderer->m_renderPass.add(makeUnique<CBorderPassElement>(borderData));
-}
-
-void Renderer::drawCachedNumber(void* monitorPtr, const Zone& zone, int number) {
-    auto* monitor = static_cast<CMonitor*>(monitorPtr);
-    if (!monitor)
-        return;
-
-    SP<CTexture> texture = getOrCreateNumberTexture(number, monitor->m_scale);
-    if (!texture)
-        return;
-
-    int texSize = static_cast<int>(40 * monitor->m_scale);
-
-    double centerX = (zone.pixelX - monitor->m_position.x + zone.pixelW / 2) * monitor->m_scale;
-    double centerY = (zone.pixelY - monitor->m_position.y + zone.pixelH / 2) * monitor->m_scale;
-
-    CBox texBox = {
-        centerX - texSize / 2.0,
-        centerY - texSize / 2.0,
-        static_cast<double>(texSize),
-        static_cast<double>(texSize)
-    };
+    auto& batch = m_batches[monitorPtr];
+    if (!batch)
+        batch = std::make_unique<ZoneBatch>();
+
+    OverlayStyle style;
+    style.inactive    = config.inactiveColor;
+    style.highlight   = config.highlightColor;
+    style.border      = config.borderColor;
+    style.alpha       = m_alpha;
+    style.borderWidth = config.borderWidth;
+
+    batch->mesh.update(resolved, monitor->m_position.x, monitor->m_position.y, monitor->m_scale, highlightedZones,
+                       style);
+
+    // Zone names below the numbers; labels still being rasterized are skipped this frame
+    m_readyLabels.clear();
+    batch->labelTextures.clear();
+    if (config.showZoneNames) {
+        const auto& zones    = resolved.layout.zones;
+        int         scaleKey = atlasScaleKey(monitor->m_scale);
+        uint32_t    color    = packColor(config.numberColor);
+        for (size_t i = 0; i < zones.size(); ++i) {
+            if (zones[i].name.empty())
+                continue;
+            const SP<CTexture>* texture = m_labels.find({zones[i].name, scaleKey, color});
+            if (!texture || !*texture)
+                continue;
+            Vector2D size = (*texture)->m_size;
+            m_readyLabels.push_back({static_cast<int>(i), static_cast<float>(size.x), static_cast<float>(size.y)});
+            batch->labelTextures.push_back((*texture)->m_texID);
+        }
+    }
 
-    CTexPassElement::SRenderData texData;
-    texData.tex = texture;
-    texData.box = texBox;
-    texData.a = m_alpha;
-    g_pHyprRenderer->m_renderPass.add(makeUnique<CTexPassElement>(texData));
+    batch->text.update(resolved, monitor->m_position.x, monitor->m_position.y, monitor->m_scale,
+                       atlas ? atlas->metrics : DigitAtlasMetrics{}, m_readyLabels);
+    batch->atlas     = atlas ? atlas->texture->m_texID : 0;
+    batch->textAlpha = m_alpha;
+    g_pHyprRenderer->m_renderPass.add(makeUnique<ZoneBatchPassElement>(*batch));
 }
 
 }  // namespace HyprZones
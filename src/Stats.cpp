@@ -0,0 +1,152 @@
+#include "hyprzones/Stats.hpp"
+#include <algorithm>
+#include <bit>
+#include <cinttypes>
+#include <cstdio>
+
+namespace HyprZones {
+
+Stats g_stats;
+
+// Values 0..7 get their own bucket; above that the top three bits select
+// the bucket: index = (exponent - 1) * 4 + next two bits
+size_t LatencyHistogram::bucketOf(uint64_t ns) {
+    if (ns < 8) {
+        return static_cast<size_t>(ns);
+    }
+    int shift = std::bit_width(ns) - 3;
+    return static_cast<size_t>(shift + 1) * 4 + ((ns >> shift) & 3);
+}
+
+uint64_t LatencyHistogram::bucketUpper(size_t bucket) {
+    if (bucket < 8) {
+        return bucket;
+    }
+    size_t shift = bucket / 4 - 1;
+    uint64_t lower = (4 + bucket % 4) << shift;
+    return lower + ((uint64_t{1} << shift) - 1);
+}
+
+uint64_t LatencyHistogram::percentile(double p) const {
+    if (m_count == 0) {
+        return 0;
+    }
+    auto     rank = static_cast<uint64_t>(p * static_cast<double>(m_count - 1)) + 1;
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        seen += m_buckets[i];
+        if (seen >= rank) {
+            uint64_t upper = bucketUpper(i);
+            return upper < m_max ? upper : m_max;
+        }
+    }
+    return m_max;
+}
+
+void Stats::reset() {
+    for (auto& histogram : m_latency) {
+        histogram.reset();
+    }
+    m_counters.fill(0);
+    m_since = Clock::now();
+}
+
+const char* Stats::name(Probe probe) {
+    switch (probe) {
+        case Probe::MouseMove: return "mouse_move";
+        case Probe::MouseButton: return "mouse_button";
+        case Probe::Render: return "render";
+        case Probe::CmdLayouts: return "cmd_layouts";
+        case Probe::CmdMoveto: return "cmd_moveto";
+        case Probe::CmdReload: return "cmd_reload";
+        case Probe::CmdSave: return "cmd_save";
+        case Probe::CmdLoad: return "cmd_load";
+        case Probe::CmdStats: return "cmd_stats";
+        case Probe::CmdTrace: return "cmd_trace";
+        case Probe::CmdBatch: return "cmd_batch";
+        case Probe::DispatchMoveto: return "dispatch_moveto";
+        case Probe::DispatchMovedir: return "dispatch_movedir";
+        case Probe::DispatchLayout: return "dispatch_layout";
+        case Probe::DispatchCycle: return "dispatch_cycle";
+        case Probe::DispatchShow: return "dispatch_show";
+        case Probe::DispatchHide: return "dispatch_hide";
+        case Probe::DispatchEditor: return "dispatch_editor";
+        case Probe::Count: break;
+    }
+    return "?";
+}
+
+const char* Stats::name(Counter counter) {
+    switch (counter) {
+        case Counter::DamageRequests: return "damage_requests";
+        case Counter::DamagedPixels: return "damaged_pixels";
+        case Counter::TexturesCreated: return "textures_created";
+        case Counter::TextureCacheHits: return "texture_cache_hits";
+        case Counter::ResolvedCacheHits: return "resolved_layout_cache_hits";
+        case Counter::ResolvedCacheMisses: return "resolved_layout_cache_misses";
+        case Counter::MappingCacheHits: return "mapping_cache_hits";
+        case Counter::MappingCacheMisses: return "mapping_cache_misses";
+        case Counter::UsableAreaChanges: return "usable_area_changes";
+        case Counter::Count: break;
+    }
+    return "?";
+}
+
+static void appendf(std::string& out, const char* format, auto... args) {
+    char buf[160];
+    int  n = std::snprintf(buf, sizeof(buf), format, args...);
+    out.append(buf, n > 0 ? std::min<size_t>(n, sizeof(buf) - 1) : 0);
+}
+
+std::string formatStats(const Stats& stats, bool json, std::span<const StatsGauge> gauges) {
+    double seconds = std::chrono::duration<double>(Stats::Clock::now() - stats.since()).count();
+    std::string out;
+
+    if (json) {
+        appendf(out, "{\"seconds\":%.3f,\"latency\":{", seconds);
+        for (size_t i = 0; i < static_cast<size_t>(Probe::Count); ++i) {
+            const auto& h = stats.latency(static_cast<Probe>(i));
+            appendf(out, "%s\"%s\":{\"count\":%" PRIu64 ",\"mean_ns\":%.0f,\"p50_ns\":%" PRIu64 ",\"p99_ns\":%" PRIu64
+                         ",\"max_ns\":%" PRIu64 "}",
+                    i ? "," : "", Stats::name(static_cast<Probe>(i)), h.count(), h.mean(), h.percentile(0.5),
+                    h.percentile(0.99), h.max());
+        }
+        out += "},\"counters\":{";
+        for (size_t i = 0; i < static_cast<size_t>(Counter::Count); ++i) {
+            appendf(out, "%s\"%s\":%" PRIu64, i ? "," : "", Stats::name(static_cast<Counter>(i)),
+                    stats.counter(static_cast<Counter>(i)));
+        }
+        out += "},\"gauges\":{";
+        for (size_t i = 0; i < gauges.size(); ++i) {
+            appendf(out, "%s\"%s\":%" PRIu64, i ? "," : "", gauges[i].first, gauges[i].second);
+        }
+        out += "}}";
+        return out;
+    }
+
+    appendf(out, "stats over %.1f s\n", seconds);
+    appendf(out, "%-18s %10s %10s %10s %10s %10s\n", "latency (us)", "count", "mean", "p50", "p99", "max");
+    for (size_t i = 0; i < static_cast<size_t>(Probe::Count); ++i) {
+        const auto& h = stats.latency(static_cast<Probe>(i));
+        if (h.count() == 0) {
+            continue;
+        }
+        appendf(out, "%-18s %10" PRIu64 " %10.2f %10.2f %10.2f %10.2f\n", Stats::name(static_cast<Probe>(i)),
+                h.count(), h.mean() / 1e3, static_cast<double>(h.percentile(0.5)) / 1e3,
+                static_cast<double>(h.percentile(0.99)) / 1e3, static_cast<double>(h.max()) / 1e3);
+    }
+    out += "counters:\n";
+    for (size_t i = 0; i < static_cast<size_t>(Counter::Count); ++i) {
+        appendf(out, "  %-30s %" PRIu64 "\n", Stats::name(static_cast<Counter>(i)),
+                stats.counter(static_cast<Counter>(i)));
+    }
+    if (!gauges.empty()) {
+        out += "gauges:\n";
+        for (const auto& [name, value] : gauges) {
+            appendf(out, "  %-30s %" PRIu64 "\n", name, value);
+        }
+    }
+    return out;
+}
+
+}  // namespace HyprZones
@@ -0,0 +1,393 @@
+#include "hyprzones/Trace.hpp"
+#include "hyprzones/Config.hpp"
+#include "hyprzones/MappedFile.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace HyprZones {
+
+static constexpr size_t FLUSH_BYTES = 64 * 1024;
+static constexpr size_t HEADER_SIZE = sizeof(TRACE_MAGIC) + sizeof(uint32_t);
+
+static bool fail(std::string* error, const std::string& what) {
+    if (error) {
+        *error = what;
+    }
+    return false;
+}
+
+template <typename T>
+static void put(std::string& out, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    out.append(bytes, sizeof(T));
+}
+
+static void putString(std::string& out, const std::string& value) {
+    auto len = static_cast<uint16_t>(std::min<size_t>(value.size(), UINT16_MAX));
+    put(out, len);
+    out.append(value.data(), len);
+}
+
+static void putGeometry(std::string& out, const MonitorGeometry& g) {
+    for (double v : {g.x, g.y, g.width, g.height, g.scale, g.reservedTop, g.reservedBottom, g.reservedLeft,
+                     g.reservedRight}) {
+        put(out, v);
+    }
+}
+
+static void putLayout(std::string& out, const Layout& layout) {
+    putString(out, layout.name);
+    put(out, layout.generation);
+    put(out, static_cast<int32_t>(layout.spacingH));
+    put(out, static_cast<int32_t>(layout.spacingV));
+    put(out, static_cast<uint32_t>(layout.zones.size()));
+    for (const auto& zone : layout.zones) {
+        putString(out, zone.name);
+        put(out, static_cast<int32_t>(zone.index));
+        put(out, zone.x);
+        put(out, zone.y);
+        put(out, zone.width);
+        put(out, zone.height);
+    }
+}
+
+bool TraceRecorder::start(const std::string& path, std::string* error) {
+    stop();
+
+    m_fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (m_fd < 0) {
+        return fail(error, "cannot create " + path + ": " + std::strerror(errno));
+    }
+
+    m_path   = path;
+    m_failed = false;
+    m_events = 0;
+    m_start  = std::chrono::steady_clock::now();
+    m_windowIds.clear();
+    m_monitorIds.clear();
+    m_monitors.clear();
+    m_lastHadWindow = false;
+    m_haveSettings  = false;
+
+    m_buffer.clear();
+    m_buffer.append(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+    put(m_buffer, TRACE_VERSION);
+    return true;
+}
+
+bool TraceRecorder::stop(std::string* error) {
+    if (m_fd < 0) {
+        return true;
+    }
+    bool ok = flush();
+    if (close(m_fd) != 0) {
+        ok = false;
+    }
+    m_fd = -1;
+    if (!ok || m_failed) {
+        return fail(error, "write " + m_path + " failed");
+    }
+    return true;
+}
+
+int64_t TraceRecorder::now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+}
+
+uint32_t TraceRecorder::idFor(std::unordered_map<void*, uint32_t>& ids, void* pointer) {
+    if (!pointer) {
+        return 0;
+    }
+    auto [it, inserted] = ids.try_emplace(pointer, static_cast<uint32_t>(ids.size() + 1));
+    return it->second;
+}
+
+bool TraceRecorder::flush() {
+    const char* p    = m_buffer.data();
+    size_t      left = m_buffer.size();
+    while (left > 0) {
+        ssize_t n = write(m_fd, p, left);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            m_failed = true;
+            break;
+        }
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+    m_buffer.clear();
+    return !m_failed;
+}
+
+void TraceRecorder::flushIfLarge() {
+    if (m_buffer.size() >= FLUSH_BYTES) {
+        flush();
+    }
+}
+
+void TraceRecorder::motion(double x, double y, uint32_t mods, void* window, const Config& config) {
+    if (!active()) {
+        return;
+    }
+
+    // Hover outside a drag never reaches the drag logic; keep only the motion that ends one
+    bool hadWindow  = m_lastHadWindow;
+    m_lastHadWindow = window != nullptr;
+    if (!window && !hadWindow) {
+        return;
+    }
+
+    put(m_buffer, TraceRecordType::Motion);
+    put(m_buffer, now());
+    put(m_buffer, x);
+    put(m_buffer, y);
+    put(m_buffer, mods);
+    put(m_buffer, idFor(m_windowIds, window));
+    ++m_events;
+
+    if (!m_haveSettings || config.snapModifier != m_snapModifier || config.showOnDrag != m_showOnDrag ||
+        config.requireModifier != m_requireModifier || config.borderWidth != m_borderWidth ||
+        config.sensitivityRadius != m_sensitivity) {
+        m_haveSettings    = true;
+        m_snapModifier    = config.snapModifier;
+        m_showOnDrag      = config.showOnDrag;
+        m_requireModifier = config.requireModifier;
+        m_borderWidth     = config.borderWidth;
+        m_sensitivity     = config.sensitivityRadius;
+
+        put(m_buffer, TraceRecordType::Settings);
+        put(m_buffer, static_cast<uint8_t>(m_showOnDrag));
+        put(m_buffer, static_cast<uint8_t>(m_requireModifier));
+        put(m_buffer, static_cast<int32_t>(m_borderWidth));
+        put(m_buffer, static_cast<int32_t>(m_sensitivity));
+        putString(m_buffer, m_snapModifier);
+    }
+    flushIfLarge();
+}
+
+void TraceRecorder::button(uint32_t button, bool pressed) {
+    if (!active()) {
+        return;
+    }
+    put(m_buffer, TraceRecordType::Button);
+    put(m_buffer, now());
+    put(m_buffer, button);
+    put(m_buffer, static_cast<uint8_t>(pressed));
+    ++m_events;
+    flushIfLarge();
+}
+
+void TraceRecorder::monitorBound(void* monitor, const ResolvedLayout* resolved) {
+    if (!active() || !monitor) {
+        return;
+    }
+
+    // Written once per monitor, again only when its geometry or layout changed
+    uint32_t     id    = idFor(m_monitorIds, monitor);
+    MonitorState state = {resolved ? resolved->key.layoutGeneration : 0, resolved != nullptr,
+                          resolved ? resolved->key.monitor : MonitorGeometry{}};
+    auto         it    = m_monitors.find(id);
+    if (it != m_monitors.end() && it->second.generation == state.generation &&
+        it->second.hasLayout == state.hasLayout && it->second.geometry == state.geometry) {
+        return;
+    }
+    m_monitors[id] = state;
+
+    put(m_buffer, TraceRecordType::Monitor);
+    put(m_buffer, id);
+    put(m_buffer, static_cast<uint8_t>(state.hasLayout));
+    putGeometry(m_buffer, state.geometry);
+    if (resolved) {
+        putLayout(m_buffer, resolved->layout);
+    }
+    flushIfLarge();
+}
+
+void TraceRecorder::snapped(void* window, const std::string& layout, const ZoneSelection& zones,
+                            const GeometryBox& box) {
+    if (!active()) {
+        return;
+    }
+    put(m_buffer, TraceRecordType::Snap);
+    put(m_buffer, now());
+    put(m_buffer, idFor(m_windowIds, window));
+    putString(m_buffer, layout);
+    put(m_buffer, static_cast<uint16_t>(zones.size()));
+    zones.forEach([&](int zone) { put(m_buffer, static_cast<uint16_t>(zone)); });
+    put(m_buffer, box.x);
+    put(m_buffer, box.y);
+    put(m_buffer, box.w);
+    put(m_buffer, box.h);
+    flushIfLarge();
+}
+
+namespace {
+
+// Bounds-checked cursor over a trace; a short read marks the reader failed
+class TraceReader {
+  public:
+    explicit TraceReader(std::string_view data) : m_data(data) {}
+
+    bool   atEnd() const { return m_pos >= m_data.size(); }
+    size_t offset() const { return m_pos; }
+    bool   ok() const { return m_ok; }
+
+    template <typename T>
+    T get() {
+        T value{};
+        if (m_data.size() - m_pos < sizeof(T)) {
+            m_ok  = false;
+            m_pos = m_data.size();
+            return value;
+        }
+        std::memcpy(&value, m_data.data() + m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return value;
+    }
+
+    std::string getString() {
+        auto len = get<uint16_t>();
+        if (m_data.size() - m_pos < len) {
+            m_ok  = false;
+            m_pos = m_data.size();
+            return {};
+        }
+        std::string value(m_data.substr(m_pos, len));
+        m_pos += len;
+        return value;
+    }
+
+    MonitorGeometry getGeometry() {
+        MonitorGeometry g;
+        for (double* v : {&g.x, &g.y, &g.width, &g.height, &g.scale, &g.reservedTop, &g.reservedBottom,
+                          &g.reservedLeft, &g.reservedRight}) {
+            *v = get<double>();
+        }
+        return g;
+    }
+
+    void getLayout(Layout& layout) {
+        layout.name       = getString();
+        layout.generation = get<uint64_t>();
+        layout.spacingH   = get<int32_t>();
+        layout.spacingV   = get<int32_t>();
+        auto count        = get<uint32_t>();
+        for (uint32_t i = 0; i < count && m_ok; ++i) {
+            Zone zone;
+            zone.name   = getString();
+            zone.index  = get<int32_t>();
+            zone.x      = get<double>();
+            zone.y      = get<double>();
+            zone.width  = get<double>();
+            zone.height = get<double>();
+            layout.zones.push_back(std::move(zone));
+        }
+    }
+
+  private:
+    std::string_view m_data;
+    size_t           m_pos = 0;
+    bool             m_ok  = true;
+};
+
+}  // namespace
+
+bool parseTrace(std::string_view data, Trace& out, std::string* error) {
+    out = {};
+    if (data.size() < HEADER_SIZE || std::memcmp(data.data(), TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0) {
+        return fail(error, "not a hyprzones trace");
+    }
+
+    TraceReader reader(data);
+    reader.get<std::array<char, sizeof(TRACE_MAGIC)>>();
+    if (auto version = reader.get<uint32_t>(); version != TRACE_VERSION) {
+        return fail(error, "unsupported trace version " + std::to_string(version));
+    }
+
+    while (!reader.atEnd()) {
+        size_t      start = reader.offset();
+        TraceRecord record;
+        record.type = reader.get<TraceRecordType>();
+
+        switch (record.type) {
+            case TraceRecordType::Settings: {
+                auto config             = std::make_shared<Config>();
+                config->showOnDrag        = reader.get<uint8_t>() != 0;
+                config->requireModifier   = reader.get<uint8_t>() != 0;
+                config->borderWidth       = reader.get<int32_t>();
+                config->sensitivityRadius = reader.get<int32_t>();
+                config->snapModifier      = reader.getString();
+                record.index            = out.configs.size();
+                out.configs.push_back(std::move(config));
+                break;
+            }
+            case TraceRecordType::Monitor: {
+                TraceMonitor monitor;
+                monitor.id        = reader.get<uint32_t>();
+                monitor.hasLayout = reader.get<uint8_t>() != 0;
+                monitor.geometry  = reader.getGeometry();
+                if (monitor.hasLayout) {
+                    reader.getLayout(monitor.layout);
+                }
+                record.index = out.monitors.size();
+                out.monitors.push_back(std::move(monitor));
+                break;
+            }
+            case TraceRecordType::Motion:
+                record.timeNs = reader.get<int64_t>();
+                record.x      = reader.get<double>();
+                record.y      = reader.get<double>();
+                record.mods   = reader.get<uint32_t>();
+                record.window = reader.get<uint32_t>();
+                break;
+            case TraceRecordType::Button:
+                record.timeNs  = reader.get<int64_t>();
+                record.button  = reader.get<uint32_t>();
+                record.pressed = reader.get<uint8_t>() != 0;
+                break;
+            case TraceRecordType::Snap: {
+                TraceSnap snap;
+                record.timeNs = reader.get<int64_t>();
+                snap.window   = reader.get<uint32_t>();
+                snap.layout   = reader.getString();
+                auto count    = reader.get<uint16_t>();
+                for (uint16_t i = 0; i < count && reader.ok(); ++i) {
+                    snap.zones.push_back(reader.get<uint16_t>());
+                }
+                snap.box.x   = reader.get<double>();
+                snap.box.y   = reader.get<double>();
+                snap.box.w   = reader.get<double>();
+                snap.box.h   = reader.get<double>();
+                record.index = out.snaps.size();
+                out.snaps.push_back(std::move(snap));
+                break;
+            }
+            default:
+                return fail(error, "unknown record type " + std::to_string(static_cast<int>(record.type)) +
+                                       " at offset " + std::to_string(start));
+        }
+
+        if (!reader.ok()) {
+            return fail(error, "truncated record at offset " + std::to_string(start));
+        }
+        out.records.push_back(record);
+    }
+    return true;
+}
+
+bool readTrace(const std::string& path, Trace& out, std::string* error) {
+    MappedFile file(path);
+    if (!file.isOpen()) {
+        return fail(error, "cannot read " + path + ": " + std::strerror(errno));
+    }
+    return parseTrace(file.view(), out, error);
+}
+
+}  // namespace HyprZones
@@ -0,0 +1,147 @@
+#include "hyprzones/TraceReplay.hpp"
+#include "hyprzones/Config.hpp"
+#include "hyprzones/DragInput.hpp"
+#include "hyprzones/ZoneManager.hpp"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <unordered_map>
+
+namespace HyprZones {
+
+namespace {
+
+// Recorded ids stand in for compositor pointers; never dereferenced
+void* fakePointer(uint32_t id) {
+    return id ? reinterpret_cast<void*>(static_cast<uintptr_t>(id) << 4) : nullptr;
+}
+
+uint32_t fakeId(void* pointer) {
+    return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(pointer) >> 4);
+}
+
+// Compositor stand-in: monitors and layouts as recorded, snaps collected
+class ReplayHost : public DragHost {
+  public:
+    explicit ReplayHost(ReplayResult& result) : m_result(result) {}
+
+    void applyMonitor(const TraceMonitor& recorded) {
+        auto& monitor    = m_monitors[recorded.id];
+        monitor.geometry = recorded.geometry;
+        monitor.resolved = recorded.hasLayout ? m_zoneManager.buildResolvedLayout(recorded.layout, recorded.geometry)
+                                              : nullptr;
+    }
+
+    // Monitor containing the point, else the nearest one (as Hyprland does)
+    void* monitorAt(double x, double y) override {
+        uint32_t best         = 0;
+        double   bestDistance = std::numeric_limits<double>::max();
+        for (const auto& [id, monitor] : m_monitors) {
+            const auto& g        = monitor.geometry;
+            double      dx       = std::max({g.x - x, 0.0, x - (g.x + g.width)});
+            double      dy       = std::max({g.y - y, 0.0, y - (g.y + g.height)});
+            double      distance = dx * dx + dy * dy;
+            if (distance < bestDistance || (distance == bestDistance && id < best)) {
+                best         = id;
+                bestDistance = distance;
+            }
+        }
+        return fakePointer(best);
+    }
+
+    std::shared_ptr<const ResolvedLayout> resolveLayout(void* monitor, const Config&) override {
+        auto it = m_monitors.find(fakeId(monitor));
+        return it != m_monitors.end() ? it->second.resolved : nullptr;
+    }
+
+    void damage(void* monitor) override {
+        auto it = m_monitors.find(fakeId(monitor));
+        if (it != m_monitors.end()) {
+            m_result.damageArea += it->second.geometry.width * it->second.geometry.height;
+        }
+        ++m_result.damages;
+    }
+
+    void damageRegion(void*, const DamageRegion& region) override {
+        m_result.damageArea += region.area();
+        ++m_result.damages;
+    }
+
+    void showOverlay() override {}
+    void hideOverlay() override {}
+
+    void snapWindow(void* window, const std::string& layoutName, const ZoneSelection& zones,
+                    const GeometryBox& box) override {
+        m_result.snaps.push_back({fakeId(window), layoutName, zones.toVector(), box});
+    }
+
+    void releaseWindow(void*) override {}
+
+  private:
+    struct Monitor {
+        MonitorGeometry                       geometry;
+        std::shared_ptr<const ResolvedLayout> resolved;
+    };
+
+    ReplayResult&                         m_result;
+    ZoneManager                           m_zoneManager;
+    std::unordered_map<uint32_t, Monitor> m_monitors;
+};
+
+bool isEvent(TraceRecordType type) {
+    return type == TraceRecordType::Motion || type == TraceRecordType::Button;
+}
+
+}  // namespace
+
+ReplayResult replayTrace(const Trace& trace) {
+    using Clock = std::chrono::steady_clock;
+
+    ReplayResult result;
+    ReplayHost   host(result);
+    DragSession  session;
+    ZoneManager  zoneManager;
+    DragInput    input(session, zoneManager, host);
+
+    std::shared_ptr<const Config> config = std::make_shared<Config>();
+    size_t                        applied = 0;  // state records before this index are applied
+
+    for (size_t i = 0; i < trace.records.size(); ++i) {
+        const auto& record = trace.records[i];
+        if (!isEvent(record.type)) {
+            continue;
+        }
+
+        // State the compositor reported while handling this event is recorded after it
+        for (applied = std::max(applied, i + 1);
+             applied < trace.records.size() && !isEvent(trace.records[applied].type); ++applied) {
+            const auto& state = trace.records[applied];
+            if (state.type == TraceRecordType::Settings) {
+                config = trace.configs[state.index];
+            } else if (state.type == TraceRecordType::Monitor) {
+                host.applyMonitor(trace.monitors[state.index]);
+            }
+        }
+
+        auto start = Clock::now();
+        if (record.type == TraceRecordType::Motion) {
+            input.motion(record.x, record.y, record.mods, fakePointer(record.window), config);
+        } else {
+            input.button(record.button, record.pressed);
+        }
+        auto latency = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+
+        (record.type == TraceRecordType::Motion ? result.motion : result.button).record(latency);
+        result.events.push_back({i, record.type, record.timeNs, latency, session.currentZone});
+    }
+
+    size_t common = std::min(result.snaps.size(), trace.snaps.size());
+    for (size_t i = 0; i < common; ++i) {
+        result.mismatches += result.snaps[i] == trace.snaps[i] ? 0 : 1;
+    }
+    result.mismatches += std::max(result.snaps.size(), trace.snaps.size()) - common;
+    return result;
+}
+
+}  // namespace HyprZones
@@ -0,0 +1,40 @@
+#define WLR_USE_UNSTABLE
+
+#include "hyprzones/WindowRegistry.hpp"
+
+#include <hyprland/src/Compositor.hpp>
+#include <hyprland/src/desktop/view/Window.hpp>
+
+namespace HyprZones {
+
+void WindowRegistry::seed() {
+    for (const auto& window : g_pCompositor->m_windows) {
+        add(window);
+    }
+}
+
+void WindowRegistry::add(const PHLWINDOW& window) {
+    if (window) {
+        m_windows[window.get()] = window;
+    }
+}
+
+void WindowRegistry::remove(void* window) {
+    m_windows.erase(window);
+}
+
+PHLWINDOW WindowRegistry::get(void* window) {
+    auto* ref = m_windows.find(window);
+    if (!ref) {
+        return nullptr;
+    }
+
+    auto locked = ref->lock();
+    if (!locked) {
+        // Close event was missed; evict the dead handle
+        m_windows.erase(window);
+    }
+    return locked;
+}
+
+}  // namespace HyprZones
@@ -1,27 +1,79 @@
 #include "hyprzones/WindowSnapper.hpp"
 #include "hyprzones/ZoneManager.hpp"
-#include "hyprzones/Globals.hpp"
 
 namespace HyprZones {
 
-void WindowSnapper::snapToZones(void* window, const Layout& layout,
-                                const std::vector<int>& zoneIndices) {
-    if (!window || zoneIndices.empty() || !g_zoneManager) {
-        return;
+bool WindowSnapper::snapToZones(void* window, const Layout& layout,
+                                const ZoneSelection& zones, GeometryRequest& out) {
+    if (!placeOnZones(window, layout, zones, out)) {
+        return false;
+    }
+
+    auto* mem = getMemory(window);
+    if (mem) {
+        mem->layoutName = layout.name;
+        mem->zones      = zones;
+        mem->released   = false;
+    }
+    return true;
+}
+
+bool WindowSnapper::placeOnZones(void* window, const Layout& layout, const ZoneSelection& zones,
+                                 GeometryRequest& out) {
+    if (!window || zones.empty()) {
+        return false;
     }
 
     double x, y, w, h;
-    g_zoneManager->getCombinedZoneBox(layout, zoneIndices, x, y, w, h);
+    m_zoneManager.getCombinedZoneBox(layout, zones, x, y, w, h);
 
     if (w <= 0 || h <= 0) {
-        return;
+        return false;
     }
 
+    out = {window, {x, y, w, h}};
+    return true;
+}
+
+bool WindowSnapper::resnap(void* window, const std::string& monitor, const Layout& layout,
+                           GeometryRequest& out) {
     auto* mem = getMemory(window);
-    if (mem) {
-        mem->layoutName  = layout.name;
-        mem->zoneIndices = zoneIndices;
+    if (!mem) {
+        return false;
+    }
+
+    // Moved to another monitor by hand: its zones meant nothing there
+    if (mem->monitor != monitor) {
+        mem->released = true;
+        return false;
+    }
+
+    // Different layout: keep the zone indices that exist there
+    ZoneSelection carried;
+    if (mem->layoutName == layout.name) {
+        carried = mem->zones;
+    } else {
+        mem->zones.forEach([&](int zone) {
+            if (zone < static_cast<int>(layout.zones.size())) {
+                carried.add(zone);
+            }
+        });
+    }
+
+    // No zone left to sit in: back to where the window was before snapping.
+    // Only a reload that removed the zones from the window's own layout
+    // ends the snap; another layout may still get them back.
+    if (carried.empty()) {
+        if (mem->layoutName == layout.name) {
+            mem->released = true;
+        }
+        if (mem->originalW <= 0 || mem->originalH <= 0) {
+            return false;
+        }
+        out = {window, {mem->originalX, mem->originalY, mem->originalW, mem->originalH}};
+        return true;
     }
+    return placeOnZones(window, layout, carried, out);
 }
 
 void WindowSnapper::unsnap(void* window) {
@@ -33,17 +85,19 @@ void WindowSnapper::unsnap(void* window) {
     forgetWindow(window);
 }
 
-void WindowSnapper::rememberWindow(void* window, const std::string& layoutName,
-                                   const std::vector<int>& zoneIndices,
+void WindowSnapper::rememberWindow(void* window, const std::string& monitor,
+                                   const std::string& layoutName,
+                                   const ZoneSelection& zones,
                                    double origX, double origY,
                                    double origW, double origH) {
     WindowMemory mem;
-    mem.layoutName  = layoutName;
-    mem.zoneIndices = zoneIndices;
-    mem.originalX   = origX;
-    mem.originalY   = origY;
-    mem.originalW   = origW;
-    mem.originalH   = origH;
+    mem.monitor    = monitor;
+    mem.layoutName = layoutName;
+    mem.zones      = zones;
+    mem.originalX  = origX;
+    mem.originalY  = origY;
+    mem.originalW  = origW;
+    mem.originalH  = origH;
 
     m_memory[window] = mem;
 }
@@ -53,19 +107,36 @@ void WindowSnapper::forgetWindow(void* window) {
 }
 
 WindowMemory* WindowSnapper::getMemory(void* window) {
-    auto it = m_memory.find(window);
-    if (it != m_memory.end()) {
-        return &it->second;
-    }
-    return nullptr;
+    return m_memory.find(window);
 }
 
-void WindowSnapper::restoreAll(const Layout& layout) {
-    for (auto& [window, mem] : m_memory) {
-        if (mem.layoutName == layout.name) {
-            snapToZones(window, layout, mem.zoneIndices);
+void WindowSnapper::remapZones(const std::string& layoutName, std::span<const int> oldToNew) {
+    m_memory.forEach([&](void*, WindowMemory& mem) {
+        if (mem.layoutName != layoutName) {
+            return;
         }
-    }
+        ZoneSelection remapped;
+        mem.zones.forEach([&](int zone) {
+            if (zone < static_cast<int>(oldToNew.size()) && oldToNew[zone] >= 0) {
+                remapped.add(oldToNew[zone]);
+            }
+        });
+        mem.zones = remapped;
+    });
+}
+
+void WindowSnapper::restoreAll(const Layout& layout, std::vector<GeometryRequest>& batch) {
+    m_memory.forEach([&](void* window, WindowMemory& mem) {
+        GeometryRequest request;
+        if (mem.layoutName == layout.name && resnap(window, mem.monitor, layout, request)) {
+            batch.push_back(request);
+        }
+    });
+    forgetReleased();
+}
+
+size_t WindowSnapper::forgetReleased() {
+    return m_memory.eraseIf([](void*, const WindowMemory& mem) { return mem.released; });
 }
 
 }  // namespace HyprZones
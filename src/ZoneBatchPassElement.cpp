@@ -0,0 +1,254 @@
+#include "hyprzones/ZoneBatchPassElement.hpp"
+
+#include <hyprland/src/render/Renderer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace HyprZones {
+
+namespace {
+
+// Positions are monitor pixels; the matrix is the compositor's monitor projection
+constexpr const char* VERTEX_SHADER = R"#(
+uniform mat3 proj;
+attribute vec2 pos;
+attribute vec4 color;
+varying vec4 v_color;
+
+void main() {
+    gl_Position = vec4(proj * vec3(pos, 1.0), 1.0);
+    v_color    = color;
+}
+)#";
+
+constexpr const char* FRAGMENT_SHADER = R"#(
+precision mediump float;
+varying vec4 v_color;
+
+void main() {
+    gl_FragColor = v_color;
+}
+)#";
+
+// Badges: atlas cells, premultiplied like the compositor's own textures
+constexpr const char* TEXT_VERTEX_SHADER = R"#(
+uniform mat3 proj;
+attribute vec2 pos;
+attribute vec2 texcoord;
+varying vec2 v_texcoord;
+
+void main() {
+    gl_Position = vec4(proj * vec3(pos, 1.0), 1.0);
+    v_texcoord  = texcoord;
+}
+)#";
+
+constexpr const char* TEXT_FRAGMENT_SHADER = R"#(
+precision mediump float;
+uniform sampler2D tex;
+uniform float alpha;
+varying vec2 v_texcoord;
+
+void main() {
+    gl_FragColor = texture2D(tex, v_texcoord) * alpha;
+}
+)#";
+
+struct Shader {
+    GLuint program = 0;
+    GLint  proj    = -1;
+    GLint  pos     = -1;
+    GLint  color   = -1;
+};
+
+struct TextShader {
+    GLuint program  = 0;
+    GLint  proj     = -1;
+    GLint  tex      = -1;
+    GLint  alpha    = -1;
+    GLint  pos      = -1;
+    GLint  texcoord = -1;
+};
+
+Shader     g_shader;
+TextShader g_textShader;
+
+bool ensureShader() {
+    if (g_shader.program)
+        return true;
+
+    g_shader.program = g_pHyprOpenGL->createProgram(VERTEX_SHADER, FRAGMENT_SHADER, true);
+    if (!g_shader.program)
+        return false;
+    g_shader.proj   = glGetUniformLocation(g_shader.program, "proj");
+    g_shader.pos    = glGetAttribLocation(g_shader.program, "pos");
+    g_shader.color  = glGetAttribLocation(g_shader.program, "color");
+    return true;
+}
+
+bool ensureTextShader() {
+    if (g_textShader.program)
+        return true;
+
+    g_textShader.program = g_pHyprOpenGL->createProgram(TEXT_VERTEX_SHADER, TEXT_FRAGMENT_SHADER, true);
+    if (!g_textShader.program)
+        return false;
+    g_textShader.proj     = glGetUniformLocation(g_textShader.program, "proj");
+    g_textShader.tex      = glGetUniformLocation(g_textShader.program, "tex");
+    g_textShader.alpha    = glGetUniformLocation(g_textShader.program, "alpha");
+    g_textShader.pos      = glGetAttribLocation(g_textShader.program, "pos");
+    g_textShader.texcoord = glGetAttribLocation(g_textShader.program, "texcoord");
+    return true;
+}
+
+// Vertex array with the attribute layout of OverlayVertex, bound to the batch's buffer
+void createBuffers(ZoneBatch& batch) {
+    glGenVertexArrays(1, &batch.vao);
+    glGenBuffers(1, &batch.vbo);
+
+    glBindVertexArray(batch.vao);
+    glBindBuffer(GL_ARRAY_BUFFER, batch.vbo);
+    glEnableVertexAttribArray(g_shader.pos);
+    glVertexAttribPointer(g_shader.pos, 2, GL_FLOAT, GL_FALSE, sizeof(OverlayVertex),
+                          reinterpret_cast<const void*>(offsetof(OverlayVertex, x)));
+    glEnableVertexAttribArray(g_shader.color);
+    glVertexAttribPointer(g_shader.color, 4, GL_FLOAT, GL_FALSE, sizeof(OverlayVertex),
+                          reinterpret_cast<const void*>(offsetof(OverlayVertex, r)));
+}
+
+// Same for OverlayTexVertex and the batch's text buffer
+void createTextBuffers(ZoneBatch& batch) {
+    glGenVertexArrays(1, &batch.textVao);
+    glGenBuffers(1, &batch.textVbo);
+
+    glBindVertexArray(batch.textVao);
+    glBindBuffer(GL_ARRAY_BUFFER, batch.textVbo);
+    glEnableVertexAttribArray(g_textShader.pos);
+    glVertexAttribPointer(g_textShader.pos, 2, GL_FLOAT, GL_FALSE, sizeof(OverlayTexVertex),
+                          reinterpret_cast<const void*>(offsetof(OverlayTexVertex, x)));
+    glEnableVertexAttribArray(g_textShader.texcoord);
+    glVertexAttribPointer(g_textShader.texcoord, 2, GL_FLOAT, GL_FALSE, sizeof(OverlayTexVertex),
+                          reinterpret_cast<const void*>(offsetof(OverlayTexVertex, u)));
+}
+
+}  // namespace
+
+void ZoneBatchPassElement::draw(const CRegion& damage) {
+    auto   vertices = m_batch.mesh.vertices();
+    auto   text     = m_batch.text.vertices();
+    size_t badgeEnd = m_batch.atlas ? m_batch.text.badgeVertexCount() : 0;
+    size_t labels   = std::min(m_batch.labelTextures.size(),
+                               (text.size() - m_batch.text.badgeVertexCount()) / OverlayTextMesh::VERTICES_PER_QUAD);
+    bool   fills    = !vertices.empty() && ensureShader();
+    bool   textured = (badgeEnd > 0 || labels > 0) && ensureTextShader();
+    if (!fills && !textured)
+        return;
+
+    const auto& renderData = g_pHyprOpenGL->m_renderData;
+    Mat3x3      matrix     = renderData.projection.copy().multiply(renderData.monitorProjection);
+
+    // Colors and textures are premultiplied
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+
+    // Walk the damage rects in place; CRegion::getRects() would allocate
+    int                   count = 0;
+    const pixman_box32_t* rects = pixman_region32_rectangles(const_cast<CRegion&>(damage).pixman(), &count);
+
+    if (fills) {
+        if (!m_batch.vao)
+            createBuffers(m_batch);
+        else
+            glBindVertexArray(m_batch.vao);
+
+        // Unchanged frames reuse what is already on the GPU
+        if (m_batch.uploaded != m_batch.mesh.version()) {
+            glBindBuffer(GL_ARRAY_BUFFER, m_batch.vbo);
+            glBufferData(GL_ARRAY_BUFFER, vertices.size_bytes(), vertices.data(), GL_STATIC_DRAW);
+            m_batch.uploaded = m_batch.mesh.version();
+        }
+
+        glUseProgram(g_shader.program);
+        glUniformMatrix3fv(g_shader.proj, 1, GL_TRUE, matrix.getMatrix().data());
+        for (int i = 0; i < count; ++i) {
+            g_pHyprOpenGL->scissor(&rects[i]);
+            glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(vertices.size()));
+        }
+    }
+
+    // Badges, then labels, over the fills: the rects don't overlap, so
+    // drawing them per layer gives the same pixels as interleaving
+    if (textured) {
+        if (!m_batch.textVao)
+            createTextBuffers(m_batch);
+        else
+            glBindVertexArray(m_batch.textVao);
+
+        if (m_batch.textUploaded != m_batch.text.version()) {
+            glBindBuffer(GL_ARRAY_BUFFER, m_batch.textVbo);
+            glBufferData(GL_ARRAY_BUFFER, text.size_bytes(), text.data(), GL_STATIC_DRAW);
+            m_batch.textUploaded = m_batch.text.version();
+        }
+
+        glUseProgram(g_textShader.program);
+        glUniformMatrix3fv(g_textShader.proj, 1, GL_TRUE, matrix.getMatrix().data());
+        glUniform1i(g_textShader.tex, 0);
+        glUniform1f(g_textShader.alpha, m_batch.textAlpha);
+        glActiveTexture(GL_TEXTURE0);
+
+        auto drawRange = [&](GLuint texture, size_t first, size_t vertexCount) {
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            for (int i = 0; i < count; ++i) {
+                g_pHyprOpenGL->scissor(&rects[i]);
+                glDrawArrays(GL_TRIANGLES, static_cast<GLint>(first), static_cast<GLsizei>(vertexCount));
+            }
+        };
+
+        if (badgeEnd > 0)
+            drawRange(m_batch.atlas, 0, badgeEnd);
+        for (size_t i = 0; i < labels; ++i) {
+            if (m_batch.labelTextures[i])
+                drawRange(m_batch.labelTextures[i],
+                          m_batch.text.badgeVertexCount() + i * OverlayTextMesh::VERTICES_PER_QUAD,
+                          OverlayTextMesh::VERTICES_PER_QUAD);
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+    g_pHyprOpenGL->scissor(nullptr);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void releaseZoneBatch(ZoneBatch& batch) {
+    if (!batch.vao && !batch.vbo && !batch.textVao && !batch.textVbo)
+        return;
+
+    g_pHyprRenderer->makeEGLCurrent();
+    glDeleteBuffers(1, &batch.vbo);
+    glDeleteVertexArrays(1, &batch.vao);
+    glDeleteBuffers(1, &batch.textVbo);
+    glDeleteVertexArrays(1, &batch.textVao);
+    batch.vbo          = 0;
+    batch.vao          = 0;
+    batch.uploaded     = 0;
+    batch.textVbo      = 0;
+    batch.textVao      = 0;
+    batch.textUploaded = 0;
+}
+
+void releaseZoneBatchShader() {
+    if (!g_shader.program && !g_textShader.program)
+        return;
+
+    g_pHyprRenderer->makeEGLCurrent();
+    glDeleteProgram(g_shader.program);
+    glDeleteProgram(g_textShader.program);
+    g_shader     = {};
+    g_textShader = {};
+}
+
+}  // namespace HyprZones
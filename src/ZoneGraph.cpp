@@ -0,0 +1,230 @@
+#include "hyprzones/ZoneGraph.hpp"
+#include "hyprzones/Zone.hpp"
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace HyprZones {
+
+namespace {
+
+struct Rect {
+    double x0, y0, x1, y1;
+};
+
+Rect rectOf(const Zone& zone) {
+    return {zone.x, zone.y, zone.x + zone.width, zone.y + zone.height};
+}
+
+double overlap(double a0, double a1, double b0, double b1) {
+    return std::min(a1, b1) - std::max(a0, b0);
+}
+
+bool intersects(const Rect& a, const Rect& b) {
+    return overlap(a.x0, a.x1, b.x0, b.x1) > ZoneGraph::EDGE_EPSILON &&
+           overlap(a.y0, a.y1, b.y0, b.y1) > ZoneGraph::EDGE_EPSILON;
+}
+
+// True if r grew to include z
+bool grow(Rect& r, const Rect& z) {
+    Rect before = r;
+    r.x0        = std::min(r.x0, z.x0);
+    r.y0        = std::min(r.y0, z.y0);
+    r.x1        = std::max(r.x1, z.x1);
+    r.y1        = std::max(r.y1, z.y1);
+    return r.x0 < before.x0 || r.y0 < before.y0 || r.x1 > before.x1 || r.y1 > before.y1;
+}
+
+int64_t edgeKey(double edge) {
+    return std::llround(edge / ZoneGraph::EDGE_EPSILON);
+}
+
+}  // namespace
+
+bool directionFromName(std::string_view name, Direction& out) {
+    if (name == "l" || name == "left")
+        out = Direction::Left;
+    else if (name == "r" || name == "right")
+        out = Direction::Right;
+    else if (name == "u" || name == "up")
+        out = Direction::Up;
+    else if (name == "d" || name == "down")
+        out = Direction::Down;
+    else
+        return false;
+    return true;
+}
+
+void ZoneGraph::clear() {
+    m_built = false;
+    m_neighbors.clear();
+    m_adjacentStart.clear();
+    m_adjacent.clear();
+}
+
+void ZoneGraph::build(const std::vector<Zone>& zones) {
+    clear();
+    m_neighbors.assign(zones.size(), {-1, -1, -1, -1});
+
+    // Zones by left and by top edge, so each right/bottom edge finds the
+    // zones starting there without comparing every pair
+    std::unordered_map<int64_t, std::vector<uint32_t>> byLeft, byTop;
+    for (size_t i = 0; i < zones.size(); ++i) {
+        if (zones[i].width <= 0 || zones[i].height <= 0)
+            continue;
+        byLeft[edgeKey(zones[i].x)].push_back(static_cast<uint32_t>(i));
+        byTop[edgeKey(zones[i].y)].push_back(static_cast<uint32_t>(i));
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> edges;  // (zone, adjacent zone), both directions
+    std::vector<double>                        best(zones.size() * 4, 0.0);
+
+    auto link = [&](uint32_t a, uint32_t b, Direction fromA, Direction fromB, double shared) {
+        edges.emplace_back(a, b);
+        edges.emplace_back(b, a);
+        auto consider = [&](uint32_t from, uint32_t to, Direction dir) {
+            auto&   slot  = m_neighbors[from][static_cast<size_t>(dir)];
+            double& share = best[from * 4 + static_cast<size_t>(dir)];
+            if (shared > share || (shared == share && static_cast<int32_t>(to) < slot)) {
+                slot  = static_cast<int32_t>(to);
+                share = shared;
+            }
+        };
+        consider(a, b, fromA);
+        consider(b, a, fromB);
+    };
+
+    auto scan = [&](const std::unordered_map<int64_t, std::vector<uint32_t>>& starts, uint32_t a, double edge,
+                    bool horizontal) {
+        int64_t key = edgeKey(edge);
+        for (int64_t k = key - 1; k <= key + 1; ++k) {
+            auto it = starts.find(k);
+            if (it == starts.end())
+                continue;
+            for (uint32_t b : it->second) {
+                const Zone& za    = zones[a];
+                const Zone& zb    = zones[b];
+                double      start = horizontal ? zb.x : zb.y;
+                if (b == a || std::abs(start - edge) > EDGE_EPSILON)
+                    continue;
+                double shared = horizontal ? overlap(za.y, za.y + za.height, zb.y, zb.y + zb.height)
+                                           : overlap(za.x, za.x + za.width, zb.x, zb.x + zb.width);
+                if (shared <= EDGE_EPSILON)
+                    continue;
+                if (horizontal)
+                    link(a, b, Direction::Right, Direction::Left, shared);
+                else
+                    link(a, b, Direction::Down, Direction::Up, shared);
+            }
+        }
+    };
+
+    for (size_t i = 0; i < zones.size(); ++i) {
+        const Zone& zone = zones[i];
+        if (zone.width <= 0 || zone.height <= 0)
+            continue;
+        scan(byLeft, static_cast<uint32_t>(i), zone.x + zone.width, true);
+        scan(byTop, static_cast<uint32_t>(i), zone.y + zone.height, false);
+    }
+
+    // Adjacency lists (CSR), ascending zone index within each list
+    std::sort(edges.begin(), edges.end());
+    m_adjacentStart.assign(zones.size() + 1, 0);
+    for (const auto& [from, to] : edges) {
+        ++m_adjacentStart[from + 1];
+    }
+    for (size_t i = 0; i < zones.size(); ++i) {
+        m_adjacentStart[i + 1] += m_adjacentStart[i];
+    }
+    m_adjacent.reserve(edges.size());
+    for (const auto& [from, to] : edges) {
+        m_adjacent.push_back(to);
+    }
+    m_built = true;
+}
+
+int ZoneGraph::neighbor(int zone, Direction dir) const {
+    if (zone < 0 || static_cast<size_t>(zone) >= m_neighbors.size())
+        return -1;
+    return m_neighbors[zone][static_cast<size_t>(dir)];
+}
+
+int ZoneGraph::neighbor(const std::vector<Zone>& zones, const ZoneSelection& from, Direction dir) const {
+    // Outermost selected zone on that side; ties keep the lower index
+    int    anchor = -1;
+    double reach  = 0;
+    from.forEach([&](int zone) {
+        if (static_cast<size_t>(zone) >= zones.size())
+            return;
+        const Zone& z = zones[zone];
+        double      edge = 0;
+        switch (dir) {
+            case Direction::Left: edge = -z.x; break;
+            case Direction::Right: edge = z.x + z.width; break;
+            case Direction::Up: edge = -z.y; break;
+            case Direction::Down: edge = z.y + z.height; break;
+        }
+        if (anchor < 0 || edge > reach + EDGE_EPSILON) {
+            anchor = zone;
+            reach  = edge;
+        }
+    });
+    return neighbor(anchor, dir);
+}
+
+std::span<const uint32_t> ZoneGraph::adjacent(int zone) const {
+    if (zone < 0 || static_cast<size_t>(zone) + 1 >= m_adjacentStart.size())
+        return {};
+    return {m_adjacent.data() + m_adjacentStart[zone], m_adjacent.data() + m_adjacentStart[zone + 1]};
+}
+
+void ZoneGraph::spanRect(const std::vector<Zone>& zones, int a, int b, ZoneSelection& out) const {
+    out.clear();
+    if (a < 0 || b < 0 || static_cast<size_t>(a) >= zones.size() || static_cast<size_t>(b) >= zones.size() ||
+        a >= ZoneSelection::CAPACITY || b >= ZoneSelection::CAPACITY) {
+        return;
+    }
+
+    // Breadth-first from both ends over zones overlapping the rectangle.
+    // Neighbors outside it are parked in `outside` and re-checked whenever
+    // an added zone grows the rectangle. Every zone is queued at most once.
+    std::array<uint16_t, ZoneSelection::CAPACITY> queue;
+    size_t                                        head = 0, tail = 0;
+    ZoneSelection                                 outside;
+
+    Rect rect  = rectOf(zones[a]);
+    bool grown = grow(rect, rectOf(zones[b]));
+
+    auto add = [&](int zone) {
+        out.add(zone);
+        queue[tail++] = static_cast<uint16_t>(zone);
+        grown |= grow(rect, rectOf(zones[zone]));
+    };
+
+    add(a);
+    if (b != a)
+        add(b);
+
+    do {
+        while (head < tail) {
+            for (uint32_t n : adjacent(queue[head++])) {
+                int zone = static_cast<int>(n);
+                if (zone >= ZoneSelection::CAPACITY || out.contains(zone))
+                    continue;
+                if (intersects(rectOf(zones[zone]), rect))
+                    add(zone);
+                else
+                    outside.add(zone);
+            }
+        }
+        if (grown) {
+            grown = false;
+            outside.forEach([&](int zone) {
+                if (!out.contains(zone) && intersects(rectOf(zones[zone]), rect))
+                    add(zone);
+            });
+        }
+    } while (head < tail);
+}
+
+}  // namespace HyprZones
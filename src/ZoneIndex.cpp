@@ -0,0 +1,177 @@
+#include "hyprzones/ZoneIndex.hpp"
+#include "hyprzones/Zone.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace HyprZones {
+
+// Upper bound per grid axis; keeps the cell table small for huge layouts
+static constexpr int MAX_GRID_DIM = 64;
+
+void ZoneIndex::clear() {
+    m_cols      = 0;
+    m_rows      = 0;
+    m_zoneCount = 0;
+    m_cellStart.clear();
+    m_cellZones.clear();
+}
+
+int ZoneIndex::cellColumn(double px) const {
+    int c = static_cast<int>(std::floor((px - m_originX) / m_cellW));
+    return std::clamp(c, 0, m_cols - 1);
+}
+
+int ZoneIndex::cellRow(double py) const {
+    int r = static_cast<int>(std::floor((py - m_originY) / m_cellH));
+    return std::clamp(r, 0, m_rows - 1);
+}
+
+bool ZoneIndex::cellOf(double px, double py, int& outCell) const {
+    if (px < m_originX || py < m_originY ||
+        px >= m_originX + m_cellW * m_cols || py >= m_originY + m_cellH * m_rows) {
+        return false;
+    }
+    outCell = cellRow(py) * m_cols + cellColumn(px);
+    return true;
+}
+
+void ZoneIndex::build(const std::vector<Zone>& zones) {
+    clear();
+    m_zoneCount = zones.size();
+
+    // Only zones with a positive area can contain a point
+    std::vector<uint32_t> order;
+    order.reserve(zones.size());
+
+    double minX = std::numeric_limits<double>::max();
+    double minY = std::numeric_limits<double>::max();
+    double maxX = std::numeric_limits<double>::lowest();
+    double maxY = std::numeric_limits<double>::lowest();
+
+    for (size_t i = 0; i < zones.size(); ++i) {
+        const auto& zone = zones[i];
+        if (zone.pixelW <= 0 || zone.pixelH <= 0) {
+            continue;
+        }
+        order.push_back(static_cast<uint32_t>(i));
+        minX = std::min(minX, zone.pixelX);
+        minY = std::min(minY, zone.pixelY);
+        maxX = std::max(maxX, zone.pixelX + zone.pixelW);
+        maxY = std::max(maxY, zone.pixelY + zone.pixelH);
+    }
+
+    if (order.empty()) {
+        // Keep a single empty cell so covers() reports a valid (empty) index
+        m_cols = m_rows = 1;
+        m_cellStart.assign(2, 0);
+        return;
+    }
+
+    // Smallest area first, ties by index (matches the linear scan's strict '<')
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return zones[a].area() < zones[b].area();
+    });
+
+    int dim = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(order.size()))));
+    dim     = std::clamp(dim, 1, MAX_GRID_DIM);
+
+    m_cols    = dim;
+    m_rows    = dim;
+    m_originX = minX;
+    m_originY = minY;
+    m_cellW   = std::max((maxX - minX) / m_cols, 1e-6);
+    m_cellH   = std::max((maxY - minY) / m_rows, 1e-6);
+
+    // Two passes: count per cell, then fill (CSR layout)
+    const size_t cellCount = static_cast<size_t>(m_cols) * m_rows;
+    m_cellStart.assign(cellCount + 1, 0);
+
+    auto forEachCell = [&](const Zone& zone, auto&& fn) {
+        int c0 = cellColumn(zone.pixelX);
+        int c1 = cellColumn(zone.pixelX + zone.pixelW);
+        int r0 = cellRow(zone.pixelY);
+        int r1 = cellRow(zone.pixelY + zone.pixelH);
+        for (int r = r0; r <= r1; ++r) {
+            for (int c = c0; c <= c1; ++c) {
+                fn(static_cast<size_t>(r) * m_cols + c);
+            }
+        }
+    };
+
+    for (uint32_t idx : order) {
+        forEachCell(zones[idx], [&](size_t cell) { ++m_cellStart[cell + 1]; });
+    }
+    std::partial_sum(m_cellStart.begin(), m_cellStart.end(), m_cellStart.begin());
+
+    m_cellZones.resize(m_cellStart.back());
+    std::vector<uint32_t> fill(m_cellStart.begin(), m_cellStart.end() - 1);
+    for (uint32_t idx : order) {
+        forEachCell(zones[idx], [&](size_t cell) { m_cellZones[fill[cell]++] = idx; });
+    }
+}
+
+int ZoneIndex::smallestAt(const std::vector<Zone>& zones, double px, double py) const {
+    int cell;
+    if (!cellOf(px, py, cell)) {
+        return -1;
+    }
+
+    for (uint32_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i) {
+        uint32_t idx = m_cellZones[i];
+        if (zones[idx].containsPoint(px, py)) {
+            return static_cast<int>(idx);
+        }
+    }
+    return -1;
+}
+
+int ZoneIndex::nearestWithin(const std::vector<Zone>& zones, double px, double py, double maxDistance) const {
+    if (m_cols == 0 || px + maxDistance < m_originX || py + maxDistance < m_originY ||
+        px - maxDistance >= m_originX + m_cellW * m_cols || py - maxDistance >= m_originY + m_cellH * m_rows) {
+        return -1;
+    }
+
+    // Cells overlapping the search square; a zone listed in several is just
+    // checked again. Ties go to the smaller area, then the lower index.
+    int    best         = -1;
+    double bestDistance = maxDistance;
+    double bestArea     = std::numeric_limits<double>::max();
+    for (int r = cellRow(py - maxDistance); r <= cellRow(py + maxDistance); ++r) {
+        for (int c = cellColumn(px - maxDistance); c <= cellColumn(px + maxDistance); ++c) {
+            size_t cell = static_cast<size_t>(r) * m_cols + c;
+            for (uint32_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i) {
+                int    idx      = static_cast<int>(m_cellZones[i]);
+                double distance = zones[idx].distanceTo(px, py);
+                double area     = zones[idx].area();
+                if (distance < bestDistance ||
+                    (distance == bestDistance && (area < bestArea || (area == bestArea && idx < best)))) {
+                    best         = idx;
+                    bestDistance = distance;
+                    bestArea     = area;
+                }
+            }
+        }
+    }
+    return best;
+}
+
+void ZoneIndex::zonesAt(const std::vector<Zone>& zones, double px, double py, std::vector<int>& out) const {
+    out.clear();
+
+    int cell;
+    if (!cellOf(px, py, cell)) {
+        return;
+    }
+
+    for (uint32_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i) {
+        uint32_t idx = m_cellZones[i];
+        if (zones[idx].containsPoint(px, py)) {
+            out.push_back(static_cast<int>(idx));
+        }
+    }
+    std::sort(out.begin(), out.end());
+}
+
+}  // namespace HyprZones
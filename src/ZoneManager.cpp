@@ -1,4 +1,5 @@
 #include "hyprzones/ZoneManager.hpp"
+#include "hyprzones/Stats.hpp"
 #include <algorithm>
 #include <limits>
 #include <set>
@@ -32,11 +33,61 @@ void ZoneManager::computeZonePixels(Layout& layout, double monitorX, double moni
         zone.pixelW = rawW - leftInset - rightInset;
         zone.pixelH = rawH - topInset - bottomInset;
     }
+
+    layout.spatialIndex.build(layout.zones);
+}
+
+std::shared_ptr<const ResolvedLayout> ZoneManager::resolveLayout(const std::string& monitorName,
+                                                                 const Layout& layout,
+                                                                 const MonitorGeometry& monitor) {
+    ResolvedLayoutKey key{layout.generation, monitor};
+
+    auto it = m_resolved.find(monitorName);
+    if (it != m_resolved.end() && it->second->key == key) {
+        g_stats.count(Counter::ResolvedCacheHits);
+        return it->second;
+    }
+
+    g_stats.count(Counter::ResolvedCacheMisses);
+    auto resolved = buildResolvedLayout(layout, monitor);
+
+    if (it != m_resolved.end()) {
+        it->second = resolved;
+    } else {
+        m_resolved.emplace(monitorName, resolved);
+    }
+    return resolved;
+}
+
+std::shared_ptr<const ResolvedLayout> ZoneManager::buildResolvedLayout(const Layout& layout,
+                                                                       const MonitorGeometry& monitor) {
+    auto resolved    = std::make_shared<ResolvedLayout>();
+    resolved->key    = {layout.generation, monitor};
+    resolved->layout = layout;
+    computeZonePixels(resolved->layout,
+                      monitor.usableX(), monitor.usableY(), monitor.usableW(), monitor.usableH(),
+                      layout.spacingH, layout.spacingV);
+    resolved->graph.build(resolved->layout.zones);
+    return resolved;
+}
+
+void ZoneManager::invalidateResolved(const std::string& monitorName) {
+    m_resolved.erase(monitorName);
+}
+
+void ZoneManager::invalidateAllResolved() {
+    m_resolved.clear();
 }
 
 std::vector<int> ZoneManager::getZonesAtPoint(const Layout& layout, double px, double py) {
     std::vector<int> result;
 
+    if (layout.spatialIndex.covers(layout.zones)) {
+        layout.spatialIndex.zonesAt(layout.zones, px, py, result);
+        return result;
+    }
+
+    // Fallback: pixels were set without computeZonePixels
     for (size_t i = 0; i < layout.zones.size(); ++i) {
         if (layout.zones[i].containsPoint(px, py)) {
             result.push_back(static_cast<int>(i));
@@ -47,6 +98,11 @@ std::vector<int> ZoneManager::getZonesAtPoint(const Layout& layout, double px, d
 }
 
 int ZoneManager::getSmallestZoneAtPoint(const Layout& layout, double px, double py) {
+    if (layout.spatialIndex.covers(layout.zones)) {
+        return layout.spatialIndex.smallestAt(layout.zones, px, py);
+    }
+
+    // Fallback: pixels were set without computeZonePixels
     int    bestIndex = -1;
     double bestArea  = std::numeric_limits<double>::max();
 
@@ -64,26 +120,39 @@ int ZoneManager::getSmallestZoneAtPoint(const Layout& layout, double px, double
     return bestIndex;
 }
 
-std::vector<int> ZoneManager::getZoneRange(const Layout& layout, int startZone, int endZone) {
-    std::vector<int> result;
-
-    if (startZone < 0 || endZone < 0) {
-        return result;
+int ZoneManager::getNearestZone(const Layout& layout, double px, double py, double maxDistance) {
+    if (layout.spatialIndex.covers(layout.zones)) {
+        return layout.spatialIndex.nearestWithin(layout.zones, px, py, maxDistance);
     }
 
-    int minZ = std::min(startZone, endZone);
-    int maxZ = std::max(startZone, endZone);
+    // Fallback: pixels were set without computeZonePixels
+    int    bestIndex    = -1;
+    double bestDistance = maxDistance;
+    double bestArea     = std::numeric_limits<double>::max();
 
-    for (int i = minZ; i <= maxZ && i < static_cast<int>(layout.zones.size()); ++i) {
-        result.push_back(i);
+    for (size_t i = 0; i < layout.zones.size(); ++i) {
+        const auto& zone = layout.zones[i];
+        if (zone.pixelW <= 0 || zone.pixelH <= 0) {
+            continue;
+        }
+        double distance = zone.distanceTo(px, py);
+        if (distance < bestDistance || (distance == bestDistance && zone.area() < bestArea)) {
+            bestIndex    = static_cast<int>(i);
+            bestDistance = distance;
+            bestArea     = zone.area();
+        }
     }
 
-    return result;
+    return bestIndex;
+}
+
+void ZoneManager::getZoneRange(const ResolvedLayout& resolved, int startZone, int endZone, ZoneSelection& out) {
+    resolved.graph.spanRect(resolved.layout.zones, startZone, endZone, out);
 }
 
-void ZoneManager::getCombinedZoneBox(const Layout& layout, const std::vector<int>& indices,
+void ZoneManager::getCombinedZoneBox(const Layout& layout, const ZoneSelection& zones,
                                      double& outX, double& outY, double& outW, double& outH) {
-    if (indices.empty()) {
+    if (zones.empty()) {
         outX = outY = outW = outH = 0;
         return;
     }
@@ -93,9 +162,9 @@ void ZoneManager::getCombinedZoneBox(const Layout& layout, const std::vector<int
     double maxX = std::numeric_limits<double>::lowest();
     double maxY = std::numeric_limits<double>::lowest();
 
-    for (int idx : indices) {
-        if (idx < 0 || idx >= static_cast<int>(layout.zones.size())) {
-            continue;
+    zones.forEach([&](int idx) {
+        if (idx >= static_cast<int>(layout.zones.size())) {
+            return;
         }
 
         const auto& zone = layout.zones[idx];
@@ -103,6 +172,11 @@ void ZoneManager::getCombinedZoneBox(const Layout& layout, const std::vector<int
         minY = std::min(minY, zone.pixelY);
         maxX = std::max(maxX, zone.pixelX + zone.pixelW);
         maxY = std::max(maxY, zone.pixelY + zone.pixelH);
+    });
+
+    if (minX > maxX || minY > maxY) {
+        outX = outY = outW = outH = 0;
+        return;
     }
 
     outX = minX;
@@ -14,16 +14,29 @@
 #include <hyprland/src/SharedDefs.hpp>
 #include <hyprland/src/event/EventBus.hpp>
 #include <hyprland/src/layout/LayoutManager.hpp>
+#include <hyprland/src/config/ConfigValue.hpp>
+#include <hyprland/src/config/ConfigDataValues.hpp>
+#include <hyprland/src/desktop/LayerSurface.hpp>
 
 #include <unistd.h>
-#include <sstream>
+#include <algorithm>
 
 #include "hyprzones/Globals.hpp"
+#include "hyprzones/BatchCommand.hpp"
 #include "hyprzones/Config.hpp"
-#include "hyprzones/DragState.hpp"
+#include "hyprzones/ConfigWatcher.hpp"
+#include "hyprzones/ConfigSaver.hpp"
+#include "hyprzones/DragInput.hpp"
+#include "hyprzones/DragSession.hpp"
 #include "hyprzones/ZoneManager.hpp"
 #include "hyprzones/LayoutManager.hpp"
+#include "hyprzones/Log.hpp"
+#include "hyprzones/MonitorTracker.hpp"
+#include "hyprzones/Stats.hpp"
+#include "hyprzones/Trace.hpp"
 #include "hyprzones/WindowSnapper.hpp"
+#include "hyprzones/WindowRegistry.hpp"
+#include "hyprzones/WindowGeometryBackend.hpp"
 #include "hyprzones/Renderer.hpp"
 
 using namespace HyprZones;
@@ -32,6 +45,18 @@ using namespace HyprZones;
 static CHyprSignalListener g_pMouseMoveListener;
 static CHyprSignalListener g_pMouseButtonListener;
 static CHyprSignalListener g_pRenderListener;
+static CHyprSignalListener g_pWindowOpenListener;
+static CHyprSignalListener g_pWindowCloseListener;
+static CHyprSignalListener g_pMonitorAddedListener;
+static CHyprSignalListener g_pMonitorRemovedListener;
+static CHyprSignalListener g_pMonitorLayoutListener;
+static CHyprSignalListener g_pLayerOpenListener;
+static CHyprSignalListener g_pLayerCloseListener;
+
+// Config watcher / saver / label worker fds in the compositor event loop
+static wl_event_source* g_configReadySource = nullptr;
+static wl_event_source* g_saveDoneSource    = nullptr;
+static wl_event_source* g_labelReadySource  = nullptr;
 
 // Helper: Get focused window
 static PHLWINDOW getFocusedWindow() {
@@ -41,232 +66,394 @@ static PHLWINDOW getFocusedWindow() {
     return monitor->m_activeWorkspace->getLastFocusedWindow();
 }
 
-// Helper: Get current monitor name
-static std::string getCurrentMonitorName() {
-    auto monitor = g_pCompositor->getMonitorFromCursor();
-    return monitor ? monitor->m_name : "";
+// Helper: Request a redraw of a monitor (counted in hyprzones:stats)
+static void damageMonitor(const PHLMONITOR& monitor) {
+    g_stats.count(Counter::DamageRequests);
+    g_stats.count(Counter::DamagedPixels, static_cast<uint64_t>(monitor->m_pixelSize.x * monitor->m_pixelSize.y));
+    g_pHyprRenderer->damageMonitor(monitor);
 }
 
-// Helper: Get current workspace ID
-static int getCurrentWorkspaceID() {
-    auto monitor = g_pCompositor->getMonitorFromCursor();
-    if (!monitor || !monitor->m_activeWorkspace)
-        return -1;
-    return monitor->m_activeWorkspace->m_id;
+// Helper: Monitor geometry as Hyprland reports it. Reserved edges are the
+// layer-surface exclusive zones (bars, docks) plus general:gaps_out.
+static MonitorGeometry readMonitorGeometry(CMonitor* monitor) {
+    static auto PGAPSOUT = CConfigValue<Hyprlang::CUSTOMTYPE>("general:gaps_out");
+    auto*       gaps     = static_cast<CCssGapData*>((PGAPSOUT.ptr())->getData());
+
+    MonitorGeometry geom;
+    geom.x = monitor->m_position.x;
+    geom.y = monitor->m_position.y;
+    geom.width = monitor->m_size.x;
+    geom.height = monitor->m_size.y;
+    geom.scale = monitor->m_scale;
+    geom.reservedTop = monitor->m_reservedTopLeft.y + gaps->m_top;
+    geom.reservedBottom = monitor->m_reservedBottomRight.y + gaps->m_bottom;
+    geom.reservedLeft = monitor->m_reservedTopLeft.x + gaps->m_left;
+    geom.reservedRight = monitor->m_reservedBottomRight.x + gaps->m_right;
+    return geom;
 }
 
-// Helper: Get usable monitor area (accounting for waybar, gaps, etc.)
-// Margins are fixed pixel offsets, identical on all monitors
-struct UsableArea {
-    double x, y, w, h;
-};
+// Helper: Re-read a monitor into the tracker; if its usable area changed,
+// drop that monitor's resolved zones and return true
+static bool refreshMonitor(CMonitor* monitor) {
+    if (!g_monitorTracker->update(monitor->m_name, readMonitorGeometry(monitor), *g_config))
+        return false;
 
-static UsableArea getUsableMonitorArea(CMonitor* monitor) {
-    constexpr int MARGIN_TOP = 97;
-    constexpr int MARGIN_BOTTOM = 22;
-    constexpr int MARGIN_LEFT = 22;
-    constexpr int MARGIN_RIGHT = 22;
+    g_stats.count(Counter::UsableAreaChanges);
+    g_zoneManager->invalidateResolved(monitor->m_name);
+    return true;
+}
+
+// Helper: Usable area of a monitor (tracked record, [[monitors]] overrides
+// applied). Read from Hyprland only the first time a monitor is seen.
+static MonitorGeometry getMonitorGeometry(CMonitor* monitor) {
+    if (auto* geometry = g_monitorTracker->find(monitor->m_name))
+        return *geometry;
 
-    UsableArea area;
-    area.x = monitor->m_position.x + MARGIN_LEFT;
-    area.y = monitor->m_position.y + MARGIN_TOP;
-    area.w = monitor->m_size.x - MARGIN_LEFT - MARGIN_RIGHT;
-    area.h = monitor->m_size.y - MARGIN_TOP - MARGIN_BOTTOM;
-    return area;
+    refreshMonitor(monitor);
+    return *g_monitorTracker->find(monitor->m_name);
 }
 
-// Callback: Mouse move
-static void onMouseMove(const Vector2D& coords, Event::SCallbackInfo& info) {
-    // Check if Hyprland is actually dragging a window via the new drag controller
-    auto target = ::g_layoutManager->dragController()->target();
-    PHLWINDOW draggedWindow = target ? target->window() : nullptr;
+// Helper: Get resolved layout (pixel rects) for a monitor's active workspace
+// Cached per monitor; only recomputed when layout or geometry changes
+static std::shared_ptr<const ResolvedLayout> getResolvedLayout(CMonitor* monitor, const Config& config) {
+    if (!monitor)
+        return nullptr;
 
-    if (!draggedWindow) {
-        // No window being dragged - reset drag state
-        if (g_dragState.isDragging) {
-            g_dragState.reset();
-            // Only auto-hide if not manually opened
-            if (!g_renderer->isManuallyOpened()) {
-                g_renderer->hide();
+    auto* layout = HyprZones::g_layoutManager->getLayoutForMonitor(
+        config, monitor->m_name,
+        monitor->m_activeWorkspace ? monitor->m_activeWorkspace->m_id : -1
+    );
+    if (!layout)
+        return nullptr;
+
+    return g_zoneManager->resolveLayout(monitor->m_name, *layout, getMonitorGeometry(monitor));
+}
+
+// Helper: Redraw the overlay on every monitor that has one (zones to draw);
+// monitors without a layout show nothing and are left alone
+static void damageOverlays() {
+    auto config = g_dragSession.config ? g_dragSession.config : g_config;
+    for (auto& m : g_pCompositor->m_monitors) {
+        auto resolved = getResolvedLayout(m.get(), *config);
+        if (resolved && !resolved->layout.zones.empty())
+            damageMonitor(m);
+    }
+}
+
+// Re-snap of remembered windows, coalesced into one batch on the next frame
+static bool g_resnapPending = false;
+
+// Helper: Re-place every remembered window on its monitor's current layout
+// in one batch, then damage each affected monitor once
+static void applyResnap() {
+    g_resnapPending = false;
+
+    auto config = g_config;
+    std::vector<GeometryRequest> batch;
+    std::vector<PHLMONITOR> affected;
+    // Layouts of workspaces not currently shown (not in the per-monitor cache)
+    std::vector<std::shared_ptr<const ResolvedLayout>> offscreen;
+
+    g_windowSnapper->forEachWindow([&](void* ptr, WindowMemory&) {
+        auto window = g_windowRegistry->get(ptr);
+        if (!window)
+            return;
+
+        auto monitor = window->m_monitor.lock();
+        if (!monitor)
+            return;
+
+        int workspace = static_cast<int>(window->workspaceID());
+        auto* layout = HyprZones::g_layoutManager->getLayoutForMonitor(*config, monitor->m_name, workspace);
+        if (!layout)
+            return;
+
+        auto geometry = getMonitorGeometry(monitor.get());
+        std::shared_ptr<const ResolvedLayout> resolved;
+        if (monitor->m_activeWorkspace && monitor->m_activeWorkspace->m_id == window->workspaceID()) {
+            resolved = g_zoneManager->resolveLayout(monitor->m_name, *layout, geometry);
+        } else {
+            ResolvedLayoutKey key{layout->generation, geometry};
+            auto it = std::find_if(offscreen.begin(), offscreen.end(),
+                [&](const auto& r) { return r->key == key; });
+            if (it != offscreen.end()) {
+                resolved = *it;
+            } else {
+                resolved = g_zoneManager->buildResolvedLayout(*layout, geometry);
+                offscreen.push_back(resolved);
             }
         }
+
+        GeometryRequest request;
+        if (!g_windowSnapper->resnap(ptr, monitor->m_name, resolved->layout, request))
+            return;
+
+        batch.push_back(request);
+        if (std::find(affected.begin(), affected.end(), monitor) == affected.end())
+            affected.push_back(monitor);
+    });
+
+    // Windows whose zones a reload removed were sent back to their original
+    // geometry; windows moved to another monitor are left where they are
+    g_windowSnapper->forgetReleased();
+
+    if (batch.empty())
         return;
-    }
 
-    // Check modifier key for zone snapping
-    uint32_t mods = g_pInputManager->getModsFromAllKBs();
-    bool modifierHeld = false;
+    g_geometryBackend->applyBatch(batch);
 
-    if (g_config.snapModifier == "SHIFT") {
-        modifierHeld = mods & HL_MODIFIER_SHIFT;
-    } else if (g_config.snapModifier == "CTRL" || g_config.snapModifier == "CONTROL") {
-        modifierHeld = mods & HL_MODIFIER_CTRL;
-    } else if (g_config.snapModifier == "ALT") {
-        modifierHeld = mods & HL_MODIFIER_ALT;
-    } else if (g_config.snapModifier == "SUPER" || g_config.snapModifier == "META") {
-        modifierHeld = mods & HL_MODIFIER_META;
+    for (auto& monitor : affected) {
+        damageMonitor(monitor);
     }
+}
 
-    bool shouldActivate = g_config.showOnDrag &&
-        (!g_config.requireModifier || modifierHeld);
-
-    if (!shouldActivate) {
-        if (g_dragState.isZoneSnapping) {
-            g_dragState.reset();
-            // Only auto-hide if not manually opened
-            if (!g_renderer->isManuallyOpened()) {
-                g_renderer->hide();
-            }
-        }
+// Helper: Schedule a batched re-snap for the next frame
+// Repeated requests before that frame (e.g. a held cycle hotkey) coalesce
+static void requestResnap() {
+    if (g_resnapPending)
         return;
+
+    g_resnapPending = true;
+    for (auto& m : g_pCompositor->m_monitors) {
+        g_pCompositor->scheduleFrameForMonitor(m);
     }
+}
 
-    auto* layout = HyprZones::g_layoutManager->getLayoutForMonitor(
-        g_config, getCurrentMonitorName(), getCurrentWorkspaceID()
-    );
+// Usable areas re-read on the next frame (layers mapped, modes or scales
+// changed); reserved edges are only final once Hyprland arranged the layers
+static bool g_monitorRefreshPending = false;
 
-    if (!layout)
+// Helper: Re-read every monitor; re-snap and redraw only if an area changed
+static void applyMonitorRefresh() {
+    g_monitorRefreshPending = false;
+
+    bool changed = false;
+    for (auto& m : g_pCompositor->m_monitors) {
+        changed |= refreshMonitor(m.get());
+    }
+    if (!changed)
         return;
 
-    auto monitor = g_pCompositor->getMonitorFromCursor();
+    requestResnap();
+    if (g_renderer->isVisible())
+        damageOverlays();
+}
 
-    // Start or continue zone snapping
-    if (!g_dragState.isDragging) {
-        g_dragState.isDragging = true;
-        g_dragState.isZoneSnapping = true;
-        g_dragState.draggedWindow = draggedWindow.get();
-        g_dragState.dragStartX = coords.x;
-        g_dragState.dragStartY = coords.y;
-        g_dragState.ctrlHeld = mods & HL_MODIFIER_CTRL;
-        g_renderer->show();
+// Helper: Schedule a usable-area refresh; events before that frame coalesce
+static void requestMonitorRefresh() {
+    if (g_monitorRefreshPending)
+        return;
 
-        // Compute zone pixels only once at drag start
-        if (monitor) {
-            auto area = getUsableMonitorArea(monitor.get());
-            g_zoneManager->computeZonePixels(*layout,
-                area.x, area.y, area.w, area.h,
-                layout->spacingH, layout->spacingV);
-        }
+    g_monitorRefreshPending = true;
+    for (auto& m : g_pCompositor->m_monitors) {
+        g_pCompositor->scheduleFrameForMonitor(m);
     }
+}
 
-    g_dragState.currentX = coords.x;
-    g_dragState.currentY = coords.y;
+// Drag host on top of Hyprland: monitors by identity, overlay via the renderer
+class HyprlandDragHost : public DragHost {
+  public:
+    void* monitorAt(double x, double y) override {
+        return g_pCompositor->getMonitorFromVector({x, y}).get();
+    }
 
-    int zone = g_zoneManager->getSmallestZoneAtPoint(*layout,
-        g_dragState.currentX, g_dragState.currentY);
+    std::shared_ptr<const ResolvedLayout> resolveLayout(void* monitor, const Config& config) override {
+        return getResolvedLayout(static_cast<CMonitor*>(monitor), config);
+    }
 
-    // Only update and request damage if zone changed
-    if (zone != g_dragState.currentZone) {
-        g_dragState.currentZone = zone;
+    // Looked up among live monitors, so a monitor unplugged mid-drag is skipped
+    void damage(void* monitor) override {
+        for (auto& m : g_pCompositor->m_monitors) {
+            if (m.get() == monitor) {
+                damageMonitor(m);
+                return;
+            }
+        }
+    }
 
-        if (zone >= 0) {
-            if (g_dragState.ctrlHeld && g_dragState.startZone >= 0) {
-                g_dragState.selectedZones = g_zoneManager->getZoneRange(
-                    *layout, g_dragState.startZone, zone);
-            } else {
-                g_dragState.selectedZones = {zone};
-                if (g_dragState.startZone < 0) {
-                    g_dragState.startZone = zone;
-                }
+    // Boxes are in global layout coordinates, which is what damageBox takes
+    void damageRegion(void* monitor, const DamageRegion& region) override {
+        for (auto& m : g_pCompositor->m_monitors) {
+            if (m.get() != monitor)
+                continue;
+            g_stats.count(Counter::DamageRequests);
+            g_stats.count(Counter::DamagedPixels, static_cast<uint64_t>(region.area() * m->m_scale * m->m_scale));
+            for (const auto& box : region.boxes()) {
+                g_pHyprRenderer->damageBox(CBox{box.x, box.y, box.w, box.h});
             }
-        } else {
-            g_dragState.selectedZones.clear();
+            return;
         }
+    }
 
-        // Request damage only when zone changes
-        if (monitor) {
-            g_pHyprRenderer->damageMonitor(monitor);
+    void showOverlay() override {
+        g_renderer->show();
+    }
+
+    void hideOverlay() override {
+        if (!g_renderer->isManuallyOpened()) {
+            g_renderer->hide();
         }
     }
+
+    void snapWindow(void* handle, const std::string& layoutName, const ZoneSelection& zones,
+                    const GeometryBox& box) override {
+        // Find the actual window handle
+        PHLWINDOW window = g_windowRegistry->get(handle);
+        if (!window)
+            return;
+
+        // Remember original size, and the monitor of the zones it lands on
+        // (the window's own monitor may not follow until after the drop)
+        auto origPos  = window->m_realPosition->goal();
+        auto origSize = window->m_realSize->goal();
+        auto monitor  = g_pCompositor->getMonitorFromVector({box.x + box.w / 2, box.y + box.h / 2});
+        if (!monitor)
+            return;
+        g_windowSnapper->rememberWindow(handle, monitor->m_name, layoutName, zones, origPos.x, origPos.y,
+                                        origSize.x, origSize.y);
+
+        g_geometryBackend->apply(window.get(), box);
+    }
+
+    // Moved or resized by hand: later re-snaps must not pull it back
+    void releaseWindow(void* handle) override {
+        g_windowSnapper->unsnap(handle);
+    }
+};
+
+static_assert(MOD_SHIFT == HL_MODIFIER_SHIFT && MOD_CTRL == HL_MODIFIER_CTRL && MOD_ALT == HL_MODIFIER_ALT &&
+              MOD_META == HL_MODIFIER_META);
+
+static HyprlandDragHost           g_dragHost;
+static std::unique_ptr<DragInput> g_dragInput;      // drives g_dragSession
+static TraceRecorder              g_traceRecorder;  // hyprctl hyprzones:trace
+
+// Callback: Mouse move
+static void onMouseMove(const Vector2D& coords, Event::SCallbackInfo& info) {
+    ScopedProbe probe(Probe::MouseMove);
+
+    // Check if Hyprland is actually dragging a window via the new drag controller
+    auto target = ::g_layoutManager->dragController()->target();
+    PHLWINDOW draggedWindow = target ? target->window() : nullptr;
+
+    uint32_t mods = 0;
+    if (draggedWindow) {
+        if (g_dragSession.draggedWindow != draggedWindow.get())
+            g_windowRegistry->add(draggedWindow);
+        mods = g_pInputManager->getModsFromAllKBs();
+    }
+
+    g_dragInput->motion(coords.x, coords.y, mods, draggedWindow.get(), g_config);
 }
 
 // Callback: Mouse button
 static void onMouseButton(const IPointer::SButtonEvent& e, Event::SCallbackInfo& info) {
-    // Only handle left mouse button release
-    if (e.button != BTN_LEFT)
+    ScopedProbe probe(Probe::MouseButton);
+    g_dragInput->button(e.button, e.state == WL_POINTER_BUTTON_STATE_PRESSED);
+}
+
+// Callback: Window opened
+static void onWindowOpen(PHLWINDOW window) {
+    g_windowRegistry->add(window);
+}
+
+// Callback: Window closed - drop its handle and zone memory so a reused
+// address can never alias a dead window
+static void onWindowClose(PHLWINDOW window) {
+    if (!window)
         return;
 
-    if (e.state == WL_POINTER_BUTTON_STATE_RELEASED) {
-        // Button released - check if we need to snap to zone
-        if (g_dragState.isDragging && g_dragState.isZoneSnapping) {
-            if (!g_dragState.selectedZones.empty() && g_dragState.draggedWindow) {
-                auto* layout = HyprZones::g_layoutManager->getLayoutForMonitor(
-                    g_config, getCurrentMonitorName(), getCurrentWorkspaceID());
-
-                if (layout) {
-                    // Compute zone pixels before getting combined box
-                    auto monitor = g_pCompositor->getMonitorFromCursor();
-                    if (monitor) {
-                        auto area = getUsableMonitorArea(monitor.get());
-                        g_zoneManager->computeZonePixels(*layout,
-                            area.x, area.y, area.w, area.h,
-                            layout->spacingH, layout->spacingV);
-                    }
-
-                    // Get combined zone box
-                    double x, y, w, h;
-                    g_zoneManager->getCombinedZoneBox(*layout,
-                        g_dragState.selectedZones, x, y, w, h);
-
-                    if (w > 0 && h > 0) {
-                        // Find the actual window handle
-                        PHLWINDOW window;
-                        for (auto& w : g_pCompositor->m_windows) {
-                            if (w.get() == g_dragState.draggedWindow) {
-                                window = w;
-                                break;
-                            }
-                        }
-
-                        if (window) {
-                            // Remember original size
-                            auto origPos = window->m_realPosition->goal();
-                            auto origSize = window->m_realSize->goal();
-                            g_windowSnapper->rememberWindow(
-                                g_dragState.draggedWindow,
-                                layout->name,
-                                g_dragState.selectedZones,
-                                origPos.x, origPos.y,
-                                origSize.x, origSize.y);
-
-                            // Build window address string for dispatcher
-                            std::stringstream addrStream;
-                            addrStream << std::hex << reinterpret_cast<uintptr_t>(window.get());
-                            std::string windowAddr = "address:0x" + addrStream.str();
-
-                            // Move and resize window using dispatchers with explicit window address
-                            std::string moveArg = "exact " +
-                                std::to_string(static_cast<int>(x)) + " " +
-                                std::to_string(static_cast<int>(y)) + "," + windowAddr;
-                            std::string sizeArg = "exact " +
-                                std::to_string(static_cast<int>(w)) + " " +
-                                std::to_string(static_cast<int>(h)) + "," + windowAddr;
-
-                            // Resize first, then move (Hyprland 0.54+ requires this order)
-                            g_pKeybindManager->m_dispatchers["resizewindowpixel"](sizeArg);
-                            g_pKeybindManager->m_dispatchers["movewindowpixel"](moveArg);
-                        }
-                    }
-                }
-            }
+    if (g_dragSession.draggedWindow == window.get())
+        g_dragInput->cancel();
 
-            // Request final damage and hide
-            auto monitor = g_pCompositor->getMonitorFromCursor();
-            if (monitor) {
-                g_pHyprRenderer->damageMonitor(monitor);
-            }
-        }
+    g_windowRegistry->remove(window.get());
+    g_windowSnapper->forgetWindow(window.get());
+}
 
-        g_dragState.reset();
-        // Only auto-hide if not manually opened
-        if (!g_renderer->isManuallyOpened()) {
-            g_renderer->hide();
+// Callback: Monitor connected - re-place windows once its layout resolves
+static void onMonitorAdded(PHLMONITOR monitor) {
+    if (monitor && g_monitorTracker->remove(monitor->m_name))
+        g_zoneManager->invalidateResolved(monitor->m_name);
+    requestMonitorRefresh();
+    requestResnap();
+}
+
+// Callback: Monitor disconnected - forget its usable area, zones and overlay batch
+static void onMonitorRemoved(PHLMONITOR monitor) {
+    if (!monitor)
+        return;
+
+    g_monitorTracker->remove(monitor->m_name);
+    g_zoneManager->invalidateResolved(monitor->m_name);
+    if (g_renderer)
+        g_renderer->forgetMonitor(monitor.get());
+}
+
+// Callback: Monitor mode, scale, transform or position changed
+static void onMonitorLayoutChanged() {
+    requestMonitorRefresh();
+}
+
+// Callback: Layer surface mapped or unmapped - bars change the reserved edges
+static void onLayerChanged(PHLLS) {
+    requestMonitorRefresh();
+}
+
+// Event loop: the config watcher finished loading a changed config. Runs
+// between events, so no frame or input handler is midway through the old
+// snapshot; a running drag keeps its pinned one.
+static int onConfigReady(int, uint32_t, void*) {
+    ReloadStatus status;
+    auto config = g_configWatcher->takeReady(&status);
+    if (!config)
+        return 0;
+
+    if (publishConfig(std::move(config)))
+        requestResnap();
+
+    if (status.errors > 0) {
+        HyprlandAPI::addNotification(
+            g_handle,
+            "[HyprZones] Config reloaded with " + std::to_string(status.errors) + " errors",
+            CHyprColor(0.9f, 0.3f, 0.2f, 1.0f),
+            5000
+        );
+    }
+    return 0;
+}
+
+// Event loop callback: background saves finished
+static int onSaveDone(int, uint32_t, void*) {
+    for (const auto& result : g_configSaver->takeResults()) {
+        if (result.ok) {
+            HyprlandAPI::addNotification(g_handle, "[HyprZones] Saved layouts to " + result.path,
+                                         CHyprColor(0.2f, 0.8f, 0.4f, 1.0f), 2000);
+        } else {
+            HyprlandAPI::addNotification(g_handle, "[HyprZones] Save failed: " + result.error,
+                                         CHyprColor(0.9f, 0.3f, 0.2f, 1.0f), 5000);
         }
     }
+    return 0;
+}
+
+// Callback: Zone name labels rasterized - upload, and redraw if the overlay shows them
+static int onLabelsReady(int, uint32_t, void*) {
+    if (g_renderer->uploadLabels() && g_renderer->isVisible())
+        damageOverlays();
+    return 0;
 }
 
 // Callback: Render (for zone overlay)
 static void onRender(eRenderStage stage) {
+    ScopedProbe probe(Probe::Render);
+
+    // Apply pending usable-area refresh and re-snap once, before the first
+    // monitor renders (a changed area queues the re-snap it needs)
+    if (stage == RENDER_PRE && g_monitorRefreshPending)
+        applyMonitorRefresh();
+    if (stage == RENDER_PRE && g_resnapPending)
+        applyResnap();
+
     if (!g_renderer || !g_renderer->isVisible())
         return;
 
@@ -281,38 +468,35 @@ static void onRender(eRenderStage stage) {
 
     CMonitor* monitor = pMonitor.get();
 
-    // Get layout for this monitor
-    auto* layout = HyprZones::g_layoutManager->getLayoutForMonitor(
-        g_config, monitor->m_name,
-        monitor->m_activeWorkspace ? monitor->m_activeWorkspace->m_id : -1
-    );
+    // Pin the snapshot for this frame (a drag's own snapshot while dragging)
+    auto config = g_dragSession.config ? g_dragSession.config : g_config;
 
-    if (!layout || layout->zones.empty())
-        return;
+    // Get cached pixel layout for this monitor
+    auto resolved = getResolvedLayout(monitor, *config);
 
-    // Compute zone pixels if needed
-    auto area = getUsableMonitorArea(monitor);
-    g_zoneManager->computeZonePixels(*layout,
-        area.x, area.y, area.w, area.h,
-        layout->spacingH, layout->spacingV);
+    if (!resolved || resolved->layout.zones.empty())
+        return;
 
-    // Render the overlay
-    g_renderer->renderOverlay(monitor, *layout, g_dragState.selectedZones, g_config);
+    // Render the overlay (highlight only on the monitor being dragged over)
+    static const ZoneSelection noZones;
+    const auto& highlighted = monitor == g_dragSession.currentMonitor ? g_dragSession.selectedZones : noZones;
+    g_renderer->renderOverlay(monitor, *resolved, highlighted, *config);
 }
 
 // IPC: List layouts
 static std::string cmdLayouts(eHyprCtlOutputFormat format, std::string) {
+    auto config = g_config;
     std::string result;
     if (format == eHyprCtlOutputFormat::FORMAT_JSON) {
         result = "[";
-        for (size_t i = 0; i < g_config.layouts.size(); ++i) {
+        for (size_t i = 0; i < config->layouts.size(); ++i) {
             if (i > 0) result += ",";
-            result += "{\"name\":\"" + g_config.layouts[i].name + "\"}";
+            result += "{\"name\":\"" + config->layouts[i].name + "\"}";
         }
         result += "]";
     } else {
         result = "layouts:\n";
-        for (const auto& layout : g_config.layouts) {
+        for (const auto& layout : config->layouts) {
             result += "  - " + layout.name + "\n";
         }
     }
@@ -335,70 +519,238 @@ static std::string cmdMoveto(eHyprCtlOutputFormat, std::string args) {
     if (!window)
         return "error: no focused window";
 
-    auto* layout = HyprZones::g_layoutManager->getLayoutForMonitor(
-        g_config, getCurrentMonitorName(), getCurrentWorkspaceID());
+    auto resolved = getResolvedLayout(g_pCompositor->getMonitorFromCursor().get(), *g_config);
 
-    if (!layout)
+    if (!resolved)
         return "error: no layout";
 
-    if (zoneIndex < 0 || zoneIndex >= static_cast<int>(layout->zones.size()))
+    const Layout& layout = resolved->layout;
+
+    if (zoneIndex < 0 || zoneIndex >= static_cast<int>(layout.zones.size()))
         return "error: zone index out of range";
 
-    // Compute zone pixels
-    auto monitor = g_pCompositor->getMonitorFromCursor();
-    if (monitor) {
-        auto area = getUsableMonitorArea(monitor.get());
-        g_zoneManager->computeZonePixels(*layout,
-            area.x, area.y, area.w, area.h,
-            layout->spacingH, layout->spacingV);
+    const auto& zone = layout.zones[zoneIndex];
+
+    // Move and resize
+    g_windowRegistry->add(window);
+    if (!g_geometryBackend->apply(window.get(), {zone.pixelX, zone.pixelY, zone.pixelW, zone.pixelH}))
+        return "error: failed to place window";
+
+    return "ok";
+}
+
+// Helper: Resolve a layout on a monitor for a batch. The layout the monitor
+// shows comes from its cache; others are resolved once per batch.
+static std::shared_ptr<const ResolvedLayout>
+resolveForBatch(CMonitor* monitor, const Layout& layout, const Config& config,
+                std::vector<std::shared_ptr<const ResolvedLayout>>& offscreen) {
+    auto shown = getResolvedLayout(monitor, config);
+    if (shown && shown->key.layoutGeneration == layout.generation)
+        return shown;
+
+    ResolvedLayoutKey key{layout.generation, getMonitorGeometry(monitor)};
+    auto it = std::find_if(offscreen.begin(), offscreen.end(), [&](const auto& r) { return r->key == key; });
+    if (it != offscreen.end())
+        return *it;
+    offscreen.push_back(g_zoneManager->buildResolvedLayout(layout, key.monitor));
+    return offscreen.back();
+}
+
+// Helper: Batch "moveto": queue a window's placement in a zone (or zone span)
+// of its workspace's layout, or of a named layout. Returns an error or "".
+static std::string batchMoveTo(const BatchOperation& op, const Config& config, std::vector<GeometryRequest>& moves,
+                               std::vector<std::shared_ptr<const ResolvedLayout>>& offscreen) {
+    auto window = g_windowRegistry->get(reinterpret_cast<void*>(op.window));
+    if (!window)
+        return "no window at that address";
+    auto monitor = window->m_monitor.lock();
+    if (!monitor)
+        return "window is not on a monitor";
+
+    const Layout* layout = nullptr;
+    if (op.layout.empty()) {
+        int workspace = static_cast<int>(window->workspaceID());
+        layout = HyprZones::g_layoutManager->getLayoutForMonitor(config, monitor->m_name, workspace);
+        if (!layout)
+            return "no layout";
+    } else {
+        auto it = config.layoutIndex.find(op.layout);
+        if (it == config.layoutIndex.end())
+            return "unknown layout: " + op.layout;
+        layout = &config.layouts[it->second];
     }
 
-    const auto& zone = layout->zones[zoneIndex];
+    auto resolved = resolveForBatch(monitor.get(), *layout, config, offscreen);
+    int  zones    = static_cast<int>(resolved->layout.zones.size());
+    if (op.zoneStart >= zones || op.zoneEnd >= zones)
+        return "zone index out of range";
+
+    ZoneSelection target;
+    g_zoneManager->getZoneRange(*resolved, op.zoneStart, op.zoneEnd, target);
+
+    // Remembered, so later layout switches and re-snaps keep the window in place
+    auto* memory = g_windowSnapper->getMemory(window.get());
+    if (!memory || memory->monitor != monitor->m_name) {
+        auto pos  = window->m_realPosition->goal();
+        auto size = window->m_realSize->goal();
+        g_windowSnapper->rememberWindow(window.get(), monitor->m_name, layout->name, target, pos.x, pos.y, size.x,
+                                        size.y);
+    }
 
-    // Move and resize
-    std::string moveArg = "exact " +
-        std::to_string(static_cast<int>(zone.pixelX)) + " " +
-        std::to_string(static_cast<int>(zone.pixelY));
-    std::string sizeArg = "exact " +
-        std::to_string(static_cast<int>(zone.pixelW)) + " " +
-        std::to_string(static_cast<int>(zone.pixelH));
+    GeometryRequest request;
+    if (!g_windowSnapper->snapToZones(window.get(), resolved->layout, target, request))
+        return "failed to place window";
+    moves.push_back(request);
+    return "";
+}
 
-    // Resize first, then move (Hyprland 0.54+ requires this order)
-    g_pKeybindManager->m_dispatchers["resizewindowpixel"](sizeArg);
-    g_pKeybindManager->m_dispatchers["movewindowpixel"](moveArg);
+// IPC: Run a list of operations (see BatchCommand.hpp) in one pass. Window
+// moves go out as one geometry batch, layout switches share one re-snap and
+// the overlay is redrawn once. Returns per-operation results as JSON.
+static std::string cmdBatch(eHyprCtlOutputFormat, std::string args) {
+    auto config     = g_config;
+    auto operations = parseBatch(args);
+    bool wasVisible = g_renderer->isVisible();
+    bool relayout   = false;
+
+    std::vector<GeometryRequest>                       moves;
+    std::vector<std::shared_ptr<const ResolvedLayout>> offscreen;
+    for (auto& op : operations) {
+        if (!op.error.empty())
+            continue;
+
+        switch (op.op) {
+            case BatchOp::MoveTo:
+                op.error = batchMoveTo(op, *config, moves, offscreen);
+                break;
+            case BatchOp::Layout: {
+                bool known = std::any_of(g_pCompositor->m_monitors.begin(), g_pCompositor->m_monitors.end(),
+                                         [&](const auto& m) { return m->m_name == op.monitor; });
+                if (!config->layoutIndex.contains(op.layout)) {
+                    op.error = "unknown layout: " + op.layout;
+                } else if (op.monitor.empty()) {
+                    HyprZones::g_layoutManager->switchLayout(*config, op.layout);
+                } else if (!known) {
+                    op.error = "unknown monitor: " + op.monitor;
+                } else {
+                    HyprZones::g_layoutManager->switchMonitorLayout(*config, op.monitor, op.layout);
+                }
+                relayout |= op.error.empty();
+                break;
+            }
+            case BatchOp::Show: g_renderer->show(true); break;
+            case BatchOp::Hide: g_renderer->hide(); break;
+            case BatchOp::Invalid: break;
+        }
+    }
 
-    return "ok";
+    if (!moves.empty())
+        g_geometryBackend->applyBatch(moves);
+    if (relayout)
+        requestResnap();
+    if (wasVisible != g_renderer->isVisible() || (relayout && wasVisible))
+        damageOverlays();
+
+    return formatBatchResults(operations);
 }
 
-// IPC: Reload config
-static std::string cmdReload(eHyprCtlOutputFormat, std::string) {
-    reloadConfig();
-    return "reloaded";
+// IPC: Reload config ("force" reloads even if the file is unchanged)
+static std::string cmdReload(eHyprCtlOutputFormat, std::string args) {
+    auto status = reloadConfig(args == "force");
+    if (status.unchanged) {
+        return "unchanged";
+    }
+    if (status.placementChanged) {
+        requestResnap();
+    }
+    if (status.errors > 0) {
+        return "reloaded with " + std::to_string(status.errors) + " errors (see " + Log::DEFAULT_PATH + ")";
+    }
+    return status.fromCache ? "reloaded (cached)" : "reloaded";
 }
 
 // IPC: Save layouts to file
+// The snapshot is serialized and written off-thread; onSaveDone reports the outcome
 static std::string cmdSave(eHyprCtlOutputFormat, std::string args) {
     std::string path = args.empty() ? getConfigPath() + ".backup" : args;
-    bool success = HyprZones::g_layoutManager->saveLayouts(path, g_config.layouts, g_config.mappings);
-    return success ? "saved to " + path : "error: failed to save";
+    if (!g_configSaver->save(path, g_config))
+        return "error: saver not running";
+    return "saving to " + path;
 }
 
 // IPC: Load layouts from file
 static std::string cmdLoad(eHyprCtlOutputFormat, std::string args) {
     std::string path = args.empty() ? getConfigPath() : args;
-    auto layouts = HyprZones::g_layoutManager->loadLayouts(path);
-    if (layouts.empty()) {
+    auto result = parseConfigFile(path);
+    if (result.config.layouts.empty()) {
         return "error: no layouts loaded from " + path;
     }
-    g_config.layouts = layouts;
-    g_config.layoutIndex.clear();
-    for (size_t i = 0; i < g_config.layouts.size(); ++i) {
-        g_config.layoutIndex[g_config.layouts[i].name] = i;
+    // Only layouts are taken from the file; mappings and settings stay
+    auto config          = std::make_shared<Config>(*g_config);
+    config->layouts      = std::move(result.config.layouts);
+    config->layoutIndex  = std::move(result.config.layoutIndex);
+    config->activeLayout = result.config.activeLayout;
+    config->sourceHash   = 0;  // no longer matches the config file
+    // Layout indices changed: recompile mappings
+    LayoutManager::compileMappings(*config);
+    size_t count = config->layouts.size();
+    if (publishConfig(std::move(config))) {
+        requestResnap();
+    }
+    std::string out = "loaded " + std::to_string(count) + " layouts from " + path;
+    if (!result.errors.empty()) {
+        out += " (" + std::to_string(result.errors.size()) + " errors)";
     }
-    if (!g_config.layouts.empty()) {
-        g_config.activeLayout = g_config.layouts[0].name;
+    return out;
+}
+
+// IPC: Latency histograms and counters; "reset" starts a new interval
+// after reporting the current one
+static std::string cmdStats(eHyprCtlOutputFormat format, std::string args) {
+    StatsGauge gauges[] = {
+        {"window_memory", g_windowSnapper->memorySize()},
+        {"tracked_windows", g_windowRegistry->size()},
+        {"log_dropped", Log::droppedCount()},
+    };
+    std::string out = formatStats(g_stats, format == eHyprCtlOutputFormat::FORMAT_JSON, gauges);
+    if (args.find("reset") != std::string::npos)
+        g_stats.reset();
+    return out;
+}
+
+// IPC: Record drag input for hyprzones_replay ("start [path]" / "stop")
+static std::string cmdTrace(eHyprCtlOutputFormat, std::string args) {
+    std::string error;
+    if (args.starts_with("start")) {
+        std::string path = args.size() > 6 ? args.substr(6) : "/tmp/hyprzones.trace";
+        if (!g_traceRecorder.start(path, &error))
+            return "error: " + error;
+        g_dragInput->setRecorder(&g_traceRecorder);
+        return "recording to " + path;
     }
-    return "loaded " + std::to_string(layouts.size()) + " layouts from " + path;
+    if (args.starts_with("stop")) {
+        if (!g_traceRecorder.active())
+            return "error: not recording";
+        g_dragInput->setRecorder(nullptr);
+        size_t events = g_traceRecorder.eventCount();
+        if (!g_traceRecorder.stop(&error))
+            return "error: " + error;
+        return "recorded " + std::to_string(events) + " events to " + g_traceRecorder.path();
+    }
+    return g_traceRecorder.active() ? "recording to " + g_traceRecorder.path() : "not recording";
+}
+
+// Timing wrappers, so every IPC entry point feeds its own histogram
+template <Probe P, std::string (*Handler)(eHyprCtlOutputFormat, std::string)>
+static std::string timedCommand(eHyprCtlOutputFormat format, std::string args) {
+    ScopedProbe probe(P);
+    return Handler(format, std::move(args));
+}
+
+template <Probe P, SDispatchResult (*Handler)(std::string)>
+static SDispatchResult timedDispatcher(std::string args) {
+    ScopedProbe probe(P);
+    return Handler(std::move(args));
 }
 
 // Dispatcher: Move to zone
@@ -411,10 +763,79 @@ static SDispatchResult dispatchMoveto(std::string args) {
     return result;
 }
 
+// Dispatcher: Move the focused window to the neighboring zone ("l", "r", "u", "d")
+static SDispatchResult dispatchMovedir(std::string args) {
+    SDispatchResult result;
+
+    Direction direction;
+    if (!directionFromName(args, direction)) {
+        result.error = "direction must be l, r, u or d";
+        return result;
+    }
+
+    auto window = getFocusedWindow();
+    if (!window) {
+        result.error = "no focused window";
+        return result;
+    }
+
+    auto monitor  = window->m_monitor.lock();
+    auto resolved = getResolvedLayout(monitor.get(), *g_config);
+    if (!resolved) {
+        result.error = "no layout";
+        return result;
+    }
+    const Layout& layout = resolved->layout;
+
+    // Zones the window was snapped to on this monitor and layout, else the
+    // zone under its center
+    auto          pos    = window->m_realPosition->goal();
+    auto          size   = window->m_realSize->goal();
+    WindowMemory* memory = g_windowSnapper->getMemory(window.get());
+    if (memory && memory->monitor != monitor->m_name)
+        memory = nullptr;
+    ZoneSelection from;
+    if (memory && memory->layoutName == layout.name) {
+        from = memory->zones;
+    } else {
+        int zone = g_zoneManager->getSmallestZoneAtPoint(layout, pos.x + size.x / 2, pos.y + size.y / 2);
+        if (zone >= 0)
+            from.set(zone);
+    }
+    if (from.empty()) {
+        result.error = "window is not in a zone";
+        return result;
+    }
+
+    int next = resolved->graph.neighbor(layout.zones, from, direction);
+    if (next < 0) {
+        result.error = "no zone in that direction";
+        return result;
+    }
+
+    ZoneSelection target;
+    target.set(next);
+    if (!memory)
+        g_windowSnapper->rememberWindow(window.get(), monitor->m_name, layout.name, target, pos.x, pos.y, size.x,
+                                        size.y);
+
+    GeometryRequest request;
+    g_windowRegistry->add(window);
+    if (!g_windowSnapper->snapToZones(window.get(), layout, target, request) ||
+        !g_geometryBackend->apply(window.get(), request.box)) {
+        result.error = "failed to place window";
+        return result;
+    }
+
+    result.success = true;
+    return result;
+}
+
 // Dispatcher: Switch layout
 static SDispatchResult dispatchLayout(std::string args) {
     SDispatchResult result;
-    HyprZones::g_layoutManager->switchLayout(g_config, args);
+    HyprZones::g_layoutManager->switchLayout(*g_config, args);
+    requestResnap();
     result.success = true;
     return result;
 }
@@ -428,7 +849,8 @@ static SDispatchResult dispatchCycleLayout(std::string args) {
             direction = std::stoi(args);
         } catch (...) {}
     }
-    HyprZones::g_layoutManager->cycleLayout(g_config, direction);
+    HyprZones::g_layoutManager->cycleLayout(*g_config, direction);
+    requestResnap();
     result.success = true;
     return result;
 }
@@ -437,32 +859,14 @@ static SDispatchResult dispatchCycleLayout(std::string args) {
 static SDispatchResult dispatchShowZones(std::string) {
     SDispatchResult result;
 
-    auto monitor = g_pCompositor->getMonitorFromCursor();
-
     if (g_renderer->isVisible()) {
         g_renderer->hide();
     } else {
         g_renderer->show(true);  // Mark as manually opened
-
-        // Compute zones for current monitor
-        if (monitor) {
-            auto* layout = HyprZones::g_layoutManager->getLayoutForMonitor(
-                g_config, monitor->m_name,
-                monitor->m_activeWorkspace ? monitor->m_activeWorkspace->m_id : -1
-            );
-            if (layout) {
-                auto area = getUsableMonitorArea(monitor.get());
-                g_zoneManager->computeZonePixels(*layout,
-                    area.x, area.y, area.w, area.h,
-                    layout->spacingH, layout->spacingV);
-            }
-        }
     }
 
-    // Request redraw on all monitors so overlay renders everywhere
-    for (auto& m : g_pCompositor->m_monitors) {
-        g_pHyprRenderer->damageMonitor(m);
-    }
+    // Redraw monitors that show (or showed) an overlay
+    damageOverlays();
 
     result.success = true;
     return result;
@@ -475,10 +879,8 @@ static SDispatchResult dispatchHideZones(std::string) {
     if (g_renderer->isVisible()) {
         g_renderer->hide();
 
-        // Redraw all monitors to clear overlay everywhere
-        for (auto& m : g_pCompositor->m_monitors) {
-            g_pHyprRenderer->damageMonitor(m);
-        }
+        // Redraw monitors that showed an overlay to clear it
+        damageOverlays();
     }
 
     result.success = true;
@@ -514,14 +916,39 @@ APICALL EXPORT PLUGIN_DESCRIPTION_INFO PLUGIN_INIT(HANDLE handle) {
         3000
     );
 
+    Log::start();
+
     // Initialize globals
     initGlobals();
+    g_dragInput = std::make_unique<DragInput>(g_dragSession, *g_zoneManager, g_dragHost);
     reloadConfig();
+    g_windowRegistry->seed();
+
+    // Hot reload: load on the watcher thread, swap on the event loop
+    if (g_configWatcher->start(getConfigPath())) {
+        g_configReadySource = wl_event_loop_add_fd(g_pCompositor->m_wlEventLoop, g_configWatcher->readyFd(),
+                                                   WL_EVENT_READABLE, onConfigReady, nullptr);
+    }
+    if (g_configSaver->start()) {
+        g_saveDoneSource = wl_event_loop_add_fd(g_pCompositor->m_wlEventLoop, g_configSaver->readyFd(),
+                                                WL_EVENT_READABLE, onSaveDone, nullptr);
+    }
+    if (g_renderer->labelReadyFd() >= 0) {
+        g_labelReadySource = wl_event_loop_add_fd(g_pCompositor->m_wlEventLoop, g_renderer->labelReadyFd(),
+                                                  WL_EVENT_READABLE, onLabelsReady, nullptr);
+    }
 
     // Register callbacks using new typed event bus API
     g_pMouseMoveListener = Event::bus()->m_events.input.mouse.move.listen(onMouseMove);
     g_pMouseButtonListener = Event::bus()->m_events.input.mouse.button.listen(onMouseButton);
     g_pRenderListener = Event::bus()->m_events.render.stage.listen(onRender);
+    g_pWindowOpenListener = Event::bus()->m_events.window.open.listen(onWindowOpen);
+    g_pWindowCloseListener = Event::bus()->m_events.window.close.listen(onWindowClose);
+    g_pMonitorAddedListener = Event::bus()->m_events.monitor.added.listen(onMonitorAdded);
+    g_pMonitorRemovedListener = Event::bus()->m_events.monitor.removed.listen(onMonitorRemoved);
+    g_pMonitorLayoutListener = Event::bus()->m_events.monitor.layoutChanged.listen(onMonitorLayoutChanged);
+    g_pLayerOpenListener = Event::bus()->m_events.layer.opened.listen(onLayerChanged);
+    g_pLayerCloseListener = Event::bus()->m_events.layer.closed.listen(onLayerChanged);
 
     // Register config values
     HyprlandAPI::addConfigValue(g_handle, "plugin:hyprzones:enabled",
@@ -533,23 +960,32 @@ APICALL EXPORT PLUGIN_DESCRIPTION_INFO PLUGIN_INIT(HANDLE handle) {
 
     // Register hyprctl commands
     HyprlandAPI::registerHyprCtlCommand(g_handle,
-        SHyprCtlCommand{"hyprzones:layouts", true, cmdLayouts});
+        SHyprCtlCommand{"hyprzones:layouts", true, timedCommand<Probe::CmdLayouts, cmdLayouts>});
     HyprlandAPI::registerHyprCtlCommand(g_handle,
-        SHyprCtlCommand{"hyprzones:moveto", true, cmdMoveto});
+        SHyprCtlCommand{"hyprzones:moveto", true, timedCommand<Probe::CmdMoveto, cmdMoveto>});
     HyprlandAPI::registerHyprCtlCommand(g_handle,
-        SHyprCtlCommand{"hyprzones:reload", true, cmdReload});
+        SHyprCtlCommand{"hyprzones:reload", true, timedCommand<Probe::CmdReload, cmdReload>});
     HyprlandAPI::registerHyprCtlCommand(g_handle,
-        SHyprCtlCommand{"hyprzones:save", true, cmdSave});
+        SHyprCtlCommand{"hyprzones:save", true, timedCommand<Probe::CmdSave, cmdSave>});
     HyprlandAPI::registerHyprCtlCommand(g_handle,
-        SHyprCtlCommand{"hyprzones:load", true, cmdLoad});
+        SHyprCtlCommand{"hyprzones:load", true, timedCommand<Probe::CmdLoad, cmdLoad>});
+    HyprlandAPI::registerHyprCtlCommand(g_handle,
+        SHyprCtlCommand{"hyprzones:stats", true, timedCommand<Probe::CmdStats, cmdStats>});
+    HyprlandAPI::registerHyprCtlCommand(g_handle,
+        SHyprCtlCommand{"hyprzones:trace", true, timedCommand<Probe::CmdTrace, cmdTrace>});
+    HyprlandAPI::registerHyprCtlCommand(g_handle,
+        SHyprCtlCommand{"hyprzones:batch", true, timedCommand<Probe::CmdBatch, cmdBatch>});
 
     // Register dispatchers (using V2 API)
-    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:moveto", dispatchMoveto);
-    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:layout", dispatchLayout);
-    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:cycle", dispatchCycleLayout);
-    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:show", dispatchShowZones);
-    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:hide", dispatchHideZones);
-    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:editor", dispatchEditor);
+    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:moveto", timedDispatcher<Probe::DispatchMoveto, dispatchMoveto>);
+    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:movedir",
+                                 timedDispatcher<Probe::DispatchMovedir, dispatchMovedir>);
+    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:layout", timedDispatcher<Probe::DispatchLayout, dispatchLayout>);
+    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:cycle",
+                                 timedDispatcher<Probe::DispatchCycle, dispatchCycleLayout>);
+    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:show", timedDispatcher<Probe::DispatchShow, dispatchShowZones>);
+    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:hide", timedDispatcher<Probe::DispatchHide, dispatchHideZones>);
+    HyprlandAPI::addDispatcherV2(g_handle, "hyprzones:editor", timedDispatcher<Probe::DispatchEditor, dispatchEditor>);
 
     HyprlandAPI::addNotification(
         g_handle,
@@ -569,7 +1005,22 @@ APICALL EXPORT void PLUGIN_EXIT() {
         CHyprColor(0.8f, 0.8f, 0.2f, 1.0f),
         2000
     );
+    if (g_configReadySource) {
+        wl_event_source_remove(g_configReadySource);
+        g_configReadySource = nullptr;
+    }
+    if (g_saveDoneSource) {
+        wl_event_source_remove(g_saveDoneSource);
+        g_saveDoneSource = nullptr;
+    }
+    if (g_labelReadySource) {
+        wl_event_source_remove(g_labelReadySource);
+        g_labelReadySource = nullptr;
+    }
+    g_dragInput.reset();
+    g_traceRecorder.stop();
     cleanupGlobals();
+    Log::stop();  // after the worker threads are joined, so their messages get flushed
 }
 
 // Plugin API version
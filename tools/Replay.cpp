@@ -0,0 +1,100 @@
+// hyprzones_replay: run a trace recorded with `hyprctl hyprzones:trace`
+// through the drag logic offline and report latency and drop decisions.
+//
+//   hyprzones_replay [-v] <trace>
+//
+// Exits 1 if the trace can't be read, 2 if a replayed drop decision
+// differs from the recorded one.
+
+#include "hyprzones/TraceReplay.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace HyprZones;
+
+static const char* typeName(TraceRecordType type) {
+    return type == TraceRecordType::Motion ? "motion" : "button";
+}
+
+static void printSnap(const char* prefix, const TraceSnap& snap) {
+    std::printf("%swindow %u -> %s zones", prefix, snap.window, snap.layout.c_str());
+    for (int zone : snap.zones) {
+        std::printf(" %d", zone);
+    }
+    std::printf(" at %.0f,%.0f %.0fx%.0f\n", snap.box.x, snap.box.y, snap.box.w, snap.box.h);
+}
+
+static void printLatency(const char* name, const LatencyHistogram& h) {
+    if (h.count() == 0) {
+        return;
+    }
+    std::printf("%-12s %10" PRIu64 " %10.2f %10.2f %10.2f %10.2f\n", name, h.count(), h.mean() / 1e3,
+                static_cast<double>(h.percentile(0.5)) / 1e3, static_cast<double>(h.percentile(0.99)) / 1e3,
+                static_cast<double>(h.max()) / 1e3);
+}
+
+int main(int argc, char** argv) {
+    bool        verbose = false;
+    std::string path;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-v") == 0) {
+            verbose = true;
+        } else {
+            path = argv[i];
+        }
+    }
+    if (path.empty()) {
+        std::fprintf(stderr, "usage: %s [-v] <trace>\n", argv[0]);
+        return 1;
+    }
+
+    Trace       trace;
+    std::string error;
+    if (!readTrace(path, trace, &error)) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    ReplayResult result = replayTrace(trace);
+
+    if (verbose) {
+        std::printf("%8s %12s %-6s %10s %5s\n", "record", "time (ms)", "event", "ns", "zone");
+        for (const auto& event : result.events) {
+            const auto& record = trace.records[event.record];
+            std::printf("%8zu %12.3f %-6s %10" PRIu64 " %5d", event.record, static_cast<double>(event.timeNs) / 1e6,
+                        typeName(event.type), event.latencyNs, event.zone);
+            if (event.type == TraceRecordType::Motion) {
+                std::printf("  %.1f,%.1f mods 0x%x window %u\n", record.x, record.y, record.mods, record.window);
+            } else {
+                std::printf("  button %u %s\n", record.button, record.pressed ? "down" : "up");
+            }
+        }
+        std::printf("\n");
+    }
+
+    std::printf("%s: %zu events, %zu monitors, %zu snaps, %zu damage requests (%.1f Mpx)\n", path.c_str(),
+                result.events.size(), trace.monitors.size(), result.snaps.size(), result.damages,
+                result.damageArea / 1e6);
+    std::printf("%-12s %10s %10s %10s %10s %10s\n", "latency (us)", "count", "mean", "p50", "p99", "max");
+    printLatency("motion", result.motion);
+    printLatency("button", result.button);
+
+    if (!result.snaps.empty()) {
+        std::printf("snaps:\n");
+        for (const auto& snap : result.snaps) {
+            printSnap("  ", snap);
+        }
+    }
+
+    if (result.mismatches != 0) {
+        std::printf("%zu drop decision(s) differ from the recording:\n", result.mismatches);
+        for (const auto& snap : trace.snaps) {
+            printSnap("  recorded ", snap);
+        }
+        return 2;
+    }
+    return 0;
+}